@@ -0,0 +1,95 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "binary/base64.hpp"
+#include "binary/hex.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/benchmark/catch_benchmark.hpp>
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace estd {
+
+namespace {
+	constexpr std::size_t buffer_size = 10 * 1024 * 1024;
+
+	std::vector<std::uint8_t> const & buffer() {
+		static std::vector<std::uint8_t> const result = [] {
+			std::vector<std::uint8_t> data(buffer_size);
+			for (std::size_t i = 0; i < data.size(); ++i) data[i] = std::uint8_t(i * 151 + (i >> 9));
+			return data;
+		}();
+		return result;
+	}
+
+	/// Hex encoding through a string stream, the usual baseline.
+	std::string ostringstream_hex(byte_view data) {
+		std::ostringstream stream;
+		stream << std::hex << std::setfill('0');
+		for (std::uint8_t byte : data) stream << std::setw(2) << int(byte);
+		return stream.str();
+	}
+}
+
+TEST_CASE("hex encoding and decoding 10 MiB", "[hex]") {
+	byte_view data = buffer();
+	std::string encoded = to_hex(data);
+	std::string output;
+	output.reserve(encoded.size());
+	byte_heap_array decoded = byte_heap_array::uninitialized(data.size());
+
+	BENCHMARK("estd::to_hex") { to_hex(data, output); return output.size(); };
+	BENCHMARK("scalar hex encode") { detail::hex::encode_scalar(data.data(), data.size(), output.data()); return output.size(); };
+	BENCHMARK("std::ostringstream") { return ostringstream_hex(data).size(); };
+	BENCHMARK("estd::from_hex") { return *from_hex(encoded, mut_byte_view{decoded.data(), decoded.size()}); };
+	BENCHMARK("scalar hex decode") { return detail::hex::decode_scalar(encoded.data(), encoded.size(), decoded.data()); };
+}
+
+TEST_CASE("base64 encoding and decoding 10 MiB", "[base64]") {
+	byte_view data = buffer();
+	std::string encoded = to_base64(data);
+	std::string output;
+	output.reserve(encoded.size());
+	byte_heap_array decoded = byte_heap_array::uninitialized(data.size());
+
+	BENCHMARK("estd::to_base64") { to_base64(data, output); return output.size(); };
+	BENCHMARK("scalar base64 encode") { detail::base64::encode_scalar(data.data(), data.size(), output.data()); return output.size(); };
+	BENCHMARK("estd::from_base64") { return *from_base64(encoded, mut_byte_view{decoded.data(), decoded.size()}); };
+	BENCHMARK("scalar base64 decode") { return detail::base64::decode_scalar(encoded.data(), encoded.size(), decoded.data()); };
+}
+
+}
@@ -0,0 +1,66 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "hash/crc32c.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/benchmark/catch_benchmark.hpp>
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <string>
+#include <vector>
+
+namespace estd {
+
+namespace {
+	/// Byte-at-a-time table driven CRC-32C, the usual hand-written baseline.
+	std::uint32_t crc32c_bytewise(byte_view data) {
+		std::uint32_t crc = ~0u;
+		for (std::uint8_t byte : data) crc = (crc >> 8) ^ detail::crc32c::slice_table[0][(crc ^ byte) & 0xff];
+		return ~crc;
+	}
+}
+
+TEST_CASE("checksumming buffers", "[crc32c]") {
+	for (std::size_t size : {std::size_t(64), std::size_t(4096), std::size_t(1024 * 1024), std::size_t(16 * 1024 * 1024)}) {
+		std::vector<std::uint8_t> data(size);
+		for (std::size_t i = 0; i < size; ++i) data[i] = std::uint8_t(i * 7);
+		byte_view input = data;
+		std::string suffix = " of " + std::to_string(size) + " bytes";
+
+		BENCHMARK("estd::crc32c" + suffix) { return crc32c(input); };
+		BENCHMARK("slicing-by-8" + suffix) { return ~detail::crc32c::software(~0u, input.data(), input.size()); };
+		BENCHMARK("byte-at-a-time table" + suffix) { return crc32c_bytewise(input); };
+	}
+}
+
+}
@@ -0,0 +1,73 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "hash/hash.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/benchmark/catch_benchmark.hpp>
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <string_view>
+
+namespace estd {
+
+namespace {
+	/// Byte-at-a-time FNV-1a, the usual hand-written baseline.
+	std::uint64_t fnv1a(byte_view data) {
+		std::uint64_t result = 0xcbf29ce484222325ULL;
+		for (std::uint8_t byte : data) {
+			result ^= byte;
+			result *= 0x100000001b3ULL;
+		}
+		return result;
+	}
+}
+
+TEST_CASE("hashing buffers", "[hash]") {
+	for (std::size_t size : {std::size_t(64), std::size_t(4096), std::size_t(16 * 1024 * 1024)}) {
+		byte_heap_array data = byte_heap_array::allocate(size);
+		for (std::size_t i = 0; i < size; ++i) data[i] = std::uint8_t(i * 7);
+		std::string_view string{reinterpret_cast<char const *>(data.data()), data.size()};
+		std::string suffix = " of " + std::to_string(size) + " bytes";
+
+		BENCHMARK("estd::hash" + suffix) { return hash(data); };
+		BENCHMARK("estd::hasher in 4 KiB chunks" + suffix) {
+			hasher state;
+			for (std::size_t i = 0; i < size; i += 4096) state.update(byte_view{data.data() + i, std::min<std::size_t>(4096, size - i)});
+			return state.digest();
+		};
+		BENCHMARK("fnv1a" + suffix) { return fnv1a(data); };
+		BENCHMARK("std::hash<std::string_view>" + suffix) { return std::hash<std::string_view>{}(string); };
+	}
+}
+
+}
@@ -0,0 +1,70 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "heap_array/heap_array.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/benchmark/catch_benchmark.hpp>
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <algorithm>
+
+namespace estd {
+
+TEST_CASE("allocating a large byte_heap_array", "[heap_array]") {
+	constexpr std::size_t size = 64 * 1024 * 1024;
+
+	BENCHMARK("allocate()") {
+		return byte_heap_array::allocate(size);
+	};
+
+	BENCHMARK("uninitialized()") {
+		return byte_heap_array::uninitialized(size);
+	};
+}
+
+TEST_CASE("allocating and filling a large byte_heap_array", "[heap_array]") {
+	constexpr std::size_t size = 64 * 1024 * 1024;
+
+	BENCHMARK("allocate()") {
+		auto array = byte_heap_array::allocate(size);
+		std::fill(array.begin(), array.end(), 0xAA);
+		return array;
+	};
+
+	BENCHMARK("uninitialized()") {
+		auto array = byte_heap_array::uninitialized(size);
+		std::fill(array.begin(), array.end(), 0xAA);
+		return array;
+	};
+}
+
+}
@@ -0,0 +1,81 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "heap_array/mmap_allocator.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/benchmark/catch_benchmark.hpp>
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <cstdint>
+
+namespace estd {
+
+namespace {
+	/// Sum a number of pseudo-randomly chosen elements of an array.
+	float random_access_sum(view<float const> data, std::size_t count) {
+		std::uint64_t state = 0x9E3779B97F4A7C15;
+		float sum = 0;
+		for (std::size_t i = 0; i < count; ++i) {
+			state = state * 6364136223846793005 + 1442695040888963407;
+			sum += data[(state >> 33) % data.size()];
+		}
+		return sum;
+	}
+}
+
+TEST_CASE("random access in a large float array", "[heap_array]") {
+	constexpr std::size_t size    = std::size_t(256) * 1024 * 1024 / sizeof(float);
+	constexpr std::size_t samples = 1024 * 1024;
+
+	auto plain       = heap_array<float>::allocate(size);
+	auto regular     = mmap_heap_array<float>::allocate(size, mmap_allocator<float>{0, huge_page_policy::none});
+	auto transparent = mmap_heap_array<float>::allocate(size, mmap_allocator<float>{0, huge_page_policy::transparent});
+	auto hugetlb     = mmap_heap_array<float>::allocate(size, mmap_allocator<float>{0, huge_page_policy::hugetlb});
+
+	BENCHMARK("new[]") {
+		return random_access_sum(plain, samples);
+	};
+
+	BENCHMARK("mmap") {
+		return random_access_sum(regular, samples);
+	};
+
+	BENCHMARK("mmap with transparent huge pages") {
+		return random_access_sum(transparent, samples);
+	};
+
+	BENCHMARK("mmap with MAP_HUGETLB") {
+		return random_access_sum(hugetlb, samples);
+	};
+}
+
+}
@@ -0,0 +1,71 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "heap_array/parallel.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/benchmark/catch_benchmark.hpp>
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <numeric>
+#include <thread>
+
+namespace estd {
+
+namespace {
+	/// Sum all elements, processing each parallel chunk on its own thread.
+	double parallel_sum(view<double const> data, std::size_t chunks) {
+		std::vector<double> sums(chunks);
+		thread_per_chunk{}(chunks, [&] (std::size_t index) {
+			view<double const> chunk = parallel_chunk(data, chunks, index);
+			sums[index] = std::accumulate(chunk.begin(), chunk.end(), 0.0);
+		});
+		return std::accumulate(sums.begin(), sums.end(), 0.0);
+	}
+}
+
+TEST_CASE("bandwidth of parallel processing after serial and parallel initialization", "[heap_array]") {
+	constexpr std::size_t size = std::size_t(512) * 1024 * 1024 / sizeof(double);
+	std::size_t const chunks = std::max(1u, std::thread::hardware_concurrency());
+
+	auto serial   = heap_array<double>::allocate(size);
+	auto parallel = allocate_parallel<double>(size, chunks);
+
+	BENCHMARK("serial initialization") {
+		return parallel_sum(serial, chunks);
+	};
+
+	BENCHMARK("parallel first-touch initialization") {
+		return parallel_sum(parallel, chunks);
+	};
+}
+
+}
@@ -0,0 +1,71 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "heap_array/heap_array.hpp"
+#include "heap_array/small_heap_array.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/benchmark/catch_benchmark.hpp>
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <numeric>
+
+namespace estd {
+
+namespace {
+	/// Allocate, fill and sum a number of small arrays.
+	template<typename Array>
+	int allocate_and_sum(std::size_t count, std::size_t size) {
+		int sum = 0;
+		for (std::size_t i = 0; i < count; ++i) {
+			Array array = Array::uninitialized(size);
+			std::iota(array.begin(), array.end(), int(i));
+			sum += std::accumulate(array.begin(), array.end(), 0);
+		}
+		return sum;
+	}
+}
+
+TEST_CASE("allocating small arrays", "[small_heap_array]") {
+	constexpr std::size_t count = 10000;
+
+	for (std::size_t size : {4, 8, 16}) {
+		BENCHMARK("heap_array<int> with " + std::to_string(size) + " elements") {
+			return allocate_and_sum<heap_array<int>>(count, size);
+		};
+
+		BENCHMARK("small_heap_array<int, 16> with " + std::to_string(size) + " elements") {
+			return allocate_and_sum<small_heap_array<int, 16>>(count, size);
+		};
+	}
+}
+
+}
@@ -0,0 +1,197 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "heap_array/spsc_ring.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/benchmark/catch_benchmark.hpp>
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace estd {
+
+namespace {
+	/// Mutex protected queue, as used before spsc_ring.
+	template<typename T>
+	class mutex_queue {
+		std::mutex mutex_;
+		std::deque<T> queue_;
+
+	public:
+		void push(T value) {
+			std::lock_guard<std::mutex> lock{mutex_};
+			queue_.push_back(std::move(value));
+		}
+
+		std::optional<T> try_pop() {
+			std::lock_guard<std::mutex> lock{mutex_};
+			if (queue_.empty()) return std::nullopt;
+			std::optional<T> result{std::move(queue_.front())};
+			queue_.pop_front();
+			return result;
+		}
+	};
+
+	/// The number of elements transferred per throughput benchmark run.
+	constexpr std::uint64_t transfer_count = 1 << 20;
+
+	/// The number of round trips per latency benchmark run.
+	constexpr std::uint64_t round_trips = 10000;
+
+	/// Transfer elements one by one from a producer thread to the calling thread.
+	template<typename Push, typename Pop>
+	std::uint64_t transfer(Push && push, Pop && pop) {
+		std::thread producer([&push] () {
+			for (std::uint64_t i = 0; i < transfer_count; ++i) push(i);
+		});
+		std::uint64_t sum = 0;
+		for (std::uint64_t received = 0; received < transfer_count;) {
+			if (std::optional<std::uint64_t> value = pop()) {
+				sum += *value;
+				++received;
+			}
+		}
+		producer.join();
+		return sum;
+	}
+
+	/// Bounce a value between the calling thread and an echo thread through two queues.
+	template<typename Queue, typename Push>
+	std::uint64_t ping_pong(Queue & request, Queue & response, Push && push) {
+		std::thread echo([&] () {
+			for (std::uint64_t i = 0; i < round_trips; ++i) {
+				std::optional<std::uint64_t> value;
+				while (!(value = request.try_pop())) {}
+				push(response, *value + 1);
+			}
+		});
+		std::uint64_t value = 0;
+		for (std::uint64_t i = 0; i < round_trips; ++i) {
+			push(request, value);
+			std::optional<std::uint64_t> reply;
+			while (!(reply = response.try_pop())) {}
+			value = *reply;
+		}
+		echo.join();
+		return value;
+	}
+}
+
+TEST_CASE("throughput of transferring 1 Mi integers between threads", "[spsc_ring]") {
+	BENCHMARK("spsc_ring::push_n / pop_n in batches of 64") {
+		spsc_ring<std::uint64_t> ring(4096);
+		std::thread producer([&ring] () {
+			std::uint64_t next = 0;
+			while (next < transfer_count) {
+				ring.push_n(std::min<std::uint64_t>(64, transfer_count - next), [&next] (view<std::uint64_t> region) {
+					for (std::uint64_t & slot : region) slot = next++;
+				});
+			}
+		});
+		std::uint64_t sum = 0;
+		for (std::uint64_t received = 0; received < transfer_count;) {
+			received += ring.pop_n(64, [&sum] (view<std::uint64_t> region) {
+				for (std::uint64_t value : region) sum += value;
+			});
+		}
+		producer.join();
+		return sum;
+	};
+
+	BENCHMARK("spsc_ring::try_push / try_pop") {
+		spsc_ring<std::uint64_t> ring(4096);
+		return transfer([&ring] (std::uint64_t value) { while (!ring.try_push(value)) {} }, [&ring] () { return ring.try_pop(); });
+	};
+
+	BENCHMARK("mutex protected std::deque") {
+		mutex_queue<std::uint64_t> queue;
+		return transfer([&queue] (std::uint64_t value) { queue.push(value); }, [&queue] () { return queue.try_pop(); });
+	};
+}
+
+TEST_CASE("latency of 10000 round trips between threads", "[spsc_ring]") {
+	BENCHMARK("spsc_ring") {
+		spsc_ring<std::uint64_t> request(64);
+		spsc_ring<std::uint64_t> response(64);
+		return ping_pong(request, response, [] (spsc_ring<std::uint64_t> & ring, std::uint64_t value) { ring.try_push(value); });
+	};
+
+	BENCHMARK("mutex protected std::deque") {
+		mutex_queue<std::uint64_t> request;
+		mutex_queue<std::uint64_t> response;
+		return ping_pong(request, response, [] (mutex_queue<std::uint64_t> & queue, std::uint64_t value) { queue.push(value); });
+	};
+}
+
+TEST_CASE("overhead of pushing and popping 1 Mi integers on one thread", "[spsc_ring]") {
+	BENCHMARK("spsc_ring::push_n / pop_n in batches of 64") {
+		spsc_ring<std::uint64_t> ring(64);
+		std::uint64_t next = 0;
+		std::uint64_t sum  = 0;
+		while (next < transfer_count) {
+			ring.push_n(64, [&next] (view<std::uint64_t> region) {
+				for (std::uint64_t & slot : region) slot = next++;
+			});
+			ring.pop_n(64, [&sum] (view<std::uint64_t> region) {
+				for (std::uint64_t value : region) sum += value;
+			});
+		}
+		return sum;
+	};
+
+	BENCHMARK("spsc_ring::try_push / try_pop") {
+		spsc_ring<std::uint64_t> ring(64);
+		std::uint64_t sum = 0;
+		for (std::uint64_t i = 0; i < transfer_count; ++i) {
+			ring.try_push(i);
+			sum += *ring.try_pop();
+		}
+		return sum;
+	};
+
+	BENCHMARK("mutex protected std::deque") {
+		mutex_queue<std::uint64_t> queue;
+		std::uint64_t sum = 0;
+		for (std::uint64_t i = 0; i < transfer_count; ++i) {
+			queue.push(i);
+			sum += *queue.try_pop();
+		}
+		return sum;
+	};
+}
+
+}
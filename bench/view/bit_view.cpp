@@ -0,0 +1,87 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "heap_array/bit_heap_array.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/benchmark/catch_benchmark.hpp>
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <algorithm>
+#include <cstddef>
+
+namespace estd {
+
+namespace {
+	/// The number of points in each mask.
+	constexpr std::size_t mask_size = 16 * 1024 * 1024;
+
+	/// Create a pseudo-random mask as bool array.
+	heap_array<bool> make_bool_mask(std::size_t seed) {
+		heap_array<bool> result = heap_array<bool>::allocate(mask_size);
+		for (std::size_t i = 0; i < mask_size; ++i) result[i] = ((i * 0x9e3779b97f4a7c15 + seed) >> 61) & 1;
+		return result;
+	}
+
+	/// Create a bit array with the same bits as a bool array.
+	bit_heap_array make_bit_mask(heap_array<bool> const & values) {
+		bit_heap_array result = bit_heap_array::allocate(values.size());
+		for (std::size_t i = 0; i < values.size(); ++i) result[i] = values[i];
+		return result;
+	}
+}
+
+TEST_CASE("combining masks of 16 Mi points", "[bit_view]") {
+	heap_array<bool> bool_a = make_bool_mask(1);
+	heap_array<bool> bool_b = make_bool_mask(2);
+	bit_heap_array bits_a = make_bit_mask(bool_a);
+	bit_heap_array bits_b = make_bit_mask(bool_b);
+
+	BENCHMARK("bit_heap_array &=") {
+		bits_a &= bits_b;
+		return bits_a.data();
+	};
+	BENCHMARK("heap_array<bool> &&") {
+		std::transform(bool_a.begin(), bool_a.end(), bool_b.begin(), bool_a.begin(), [] (bool a, bool b) { return a && b; });
+		return bool_a.data();
+	};
+}
+
+TEST_CASE("counting masks of 16 Mi points", "[bit_view]") {
+	heap_array<bool> bool_mask = make_bool_mask(1);
+	bit_heap_array bit_mask = make_bit_mask(bool_mask);
+
+	BENCHMARK("bit_heap_array::count") { return bit_mask.count(); };
+	BENCHMARK("std::count on heap_array<bool>") { return std::count(bool_mask.begin(), bool_mask.end(), true); };
+}
+
+}
@@ -0,0 +1,77 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "view/view.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/benchmark/catch_benchmark.hpp>
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace estd {
+
+namespace {
+	/// Run the comparison benchmarks on two equal buffers that differ only in the last element.
+	template<typename T>
+	void benchmark_compare(std::size_t byte_size) {
+		std::vector<T> a(byte_size / sizeof(T), T(3));
+		std::vector<T> b = a;
+		std::vector<T> c = a;
+		c.back() = T(4);
+
+		view<T const> view_a{a};
+		view<T const> view_b{b};
+		view<T const> view_c{c};
+
+		std::string suffix = " " + std::to_string(byte_size / 1024) + " KiB";
+		BENCHMARK("estd::view::operator==" + suffix) { return view_a == view_b; };
+		BENCHMARK("std::equal" + suffix) { return std::equal(a.begin(), a.end(), b.begin(), b.end()); };
+		BENCHMARK("estd::view::operator<" + suffix) { return view_a < view_c; };
+		BENCHMARK("std::lexicographical_compare" + suffix) {
+			return std::lexicographical_compare(a.begin(), a.end(), c.begin(), c.end());
+		};
+	}
+}
+
+TEST_CASE("comparing byte views", "[compare]") {
+	for (std::size_t size : {1024, 64 * 1024, 1024 * 1024}) benchmark_compare<std::uint8_t>(size);
+}
+
+TEST_CASE("comparing views of 32 bit integers", "[compare]") {
+	for (std::size_t size : {1024, 64 * 1024, 1024 * 1024}) benchmark_compare<std::uint32_t>(size);
+}
+
+}
@@ -0,0 +1,93 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "view/search.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/benchmark/catch_benchmark.hpp>
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace estd {
+
+namespace {
+	/// Size of the searched buffer, divide by the reported time to get the throughput.
+	constexpr std::size_t buffer_size = 64 * 1024 * 1024;
+
+	/// A buffer of filler bytes where every search hits only in the last few bytes.
+	std::vector<std::uint8_t> const & buffer() {
+		static std::vector<std::uint8_t> const result = [] {
+			std::vector<std::uint8_t> data(buffer_size);
+			for (std::size_t i = 0; i < data.size(); ++i) data[i] = std::uint8_t('a' + i % 16);
+			std::memcpy(data.data() + data.size() - 6, "XYZ!?#", 6);
+			return data;
+		}();
+		return result;
+	}
+}
+
+TEST_CASE("finding a byte in 64 MiB", "[search]") {
+	byte_view data = buffer();
+
+	BENCHMARK("estd::find") { return find(data, '#'); };
+	BENCHMARK("std::memchr") { return std::memchr(data.data(), '#', data.size()); };
+	BENCHMARK("std::find") { return std::find(data.begin(), data.end(), '#'); };
+}
+
+TEST_CASE("counting a byte in 64 MiB", "[search]") {
+	byte_view data = buffer();
+
+	BENCHMARK("estd::count") { return count(data, 'c'); };
+	BENCHMARK("std::count") { return std::count(data.begin(), data.end(), 'c'); };
+}
+
+TEST_CASE("finding any byte from a set in 64 MiB", "[search]") {
+	byte_view data = buffer();
+	std::uint8_t const set[] = {'!', '?', '#', 'X', '\n', '\r', '\t', ' '};
+
+	BENCHMARK("estd::find_any") { return find_any(data, {set, sizeof(set)}); };
+	BENCHMARK("std::find_first_of") { return std::find_first_of(data.begin(), data.end(), std::begin(set), std::end(set)); };
+}
+
+TEST_CASE("finding a sequence in 64 MiB", "[search]") {
+	byte_view data = buffer();
+	std::uint8_t const needle[] = {'Z', '!', '?'};
+
+	BENCHMARK("estd::find") { return find(data, byte_view{needle, sizeof(needle)}); };
+	BENCHMARK("memmem") { return memmem(data.data(), data.size(), needle, sizeof(needle)); };
+	BENCHMARK("std::search") { return std::search(data.begin(), data.end(), std::begin(needle), std::end(needle)); };
+}
+
+}
@@ -0,0 +1,101 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "view/split.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/benchmark/catch_benchmark.hpp>
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <sstream>
+#include <string>
+
+namespace estd {
+
+namespace {
+	/// About 16 MiB of comma separated lines with CRLF line endings.
+	std::string const & text() {
+		static std::string const result = [] {
+			std::string data;
+			data.reserve(16 * 1024 * 1024 + 128);
+			for (std::size_t line = 0; data.size() < 16 * 1024 * 1024; ++line) {
+				for (std::size_t field = 0; field < 8; ++field) {
+					data += std::to_string(line * 8 + field * 12345);
+					data += field == 7 ? "\r\n" : ",";
+				}
+			}
+			return data;
+		}();
+		return result;
+	}
+}
+
+TEST_CASE("splitting 16 MiB of text on a character", "[split]") {
+	std::string_view data = text();
+
+	BENCHMARK("estd::split") {
+		std::size_t total = 0;
+		for (std::string_view field : split(data, ',')) total += field.size();
+		return total;
+	};
+
+	BENCHMARK("std::getline") {
+		std::istringstream stream{std::string{data}};
+		std::string field;
+		std::size_t total = 0;
+		while (std::getline(stream, field, ',')) total += field.size();
+		return total;
+	};
+}
+
+TEST_CASE("splitting 16 MiB of text on CRLF", "[split]") {
+	std::string_view data = text();
+
+	BENCHMARK("estd::split") {
+		std::size_t total = 0;
+		for (std::string_view line : split(data, "\r\n")) total += line.size();
+		return total;
+	};
+
+	BENCHMARK("std::getline and strip CR") {
+		std::istringstream stream{std::string{data}};
+		std::string line;
+		std::size_t total = 0;
+		while (std::getline(stream, line)) {
+			if (!line.empty() && line.back() == '\r') line.pop_back();
+			total += line.size();
+		}
+		return total;
+	};
+}
+
+}
@@ -0,0 +1,312 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "../array/initialize.hpp"
+#include "../convert/convert.hpp"
+#include "../heap_array/heap_array.hpp"
+#include "../result/error.hpp"
+#include "../result/result.hpp"
+#include "../utility/cpu_features.hpp"
+#include "../view/view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+#  include <immintrin.h>
+#endif
+
+namespace estd {
+
+/// Conversion tag to encode bytes as base64 text and to decode them again.
+/**
+ * Use as `estd::convert<std::string, estd::base64_encoding>(bytes)`
+ * or `estd::parse<estd::byte_heap_array, estd::error, estd::base64_encoding>(text)`.
+ */
+struct base64_encoding {};
+
+namespace detail::base64 {
+	constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	/// The value of each base64 character, or 0xff for characters outside the alphabet.
+	inline constexpr std::array<std::uint8_t, 256> values = make_array<256>([] (std::size_t c) -> std::uint8_t {
+		for (std::uint8_t i = 0; i < 64; ++i) {
+			if (std::size_t(alphabet[i]) == c) return i;
+		}
+		return 0xff;
+	});
+
+	inline void encode_scalar(std::uint8_t const * input, std::size_t size, char * output) {
+		std::size_t i = 0;
+		for (; i + 3 <= size; i += 3) {
+			std::uint32_t group = std::uint32_t(input[i]) << 16 | std::uint32_t(input[i + 1]) << 8 | input[i + 2];
+			*output++ = alphabet[group >> 18];
+			*output++ = alphabet[(group >> 12) & 0x3f];
+			*output++ = alphabet[(group >> 6) & 0x3f];
+			*output++ = alphabet[group & 0x3f];
+		}
+		if (size - i == 1) {
+			*output++ = alphabet[input[i] >> 2];
+			*output++ = alphabet[(input[i] & 0x03) << 4];
+			*output++ = '=';
+			*output++ = '=';
+		} else if (size - i == 2) {
+			*output++ = alphabet[input[i] >> 2];
+			*output++ = alphabet[(input[i] & 0x03) << 4 | input[i + 1] >> 4];
+			*output++ = alphabet[(input[i + 1] & 0x0f) << 2];
+			*output++ = '=';
+		}
+	}
+
+	/// Decode groups of four characters, returning the index of the first invalid character or npos.
+	/**
+	 * Padding is only accepted in the last group.
+	 */
+	inline std::size_t decode_scalar(char const * input, std::size_t size, std::uint8_t * output) {
+		for (std::size_t i = 0; i < size; i += 4) {
+			bool last = i + 4 == size;
+			std::size_t padding = 0;
+			if (last && input[i + 3] == '=') padding = input[i + 2] == '=' ? 2 : 1;
+
+			std::uint32_t group = 0;
+			for (std::size_t k = 0; k < 4 - padding; ++k) {
+				std::uint8_t value = values[std::uint8_t(input[i + k])];
+				if (value == 0xff) return i + k;
+				group = group << 6 | value;
+			}
+			group <<= 6 * padding;
+
+			*output++ = std::uint8_t(group >> 16);
+			if (padding < 2) *output++ = std::uint8_t(group >> 8);
+			if (padding < 1) *output++ = std::uint8_t(group);
+		}
+		return std::size_t(-1);
+	}
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+	/// Encode 24 bytes at a time, returning the number of bytes encoded.
+	/**
+	 * Each 128 bit lane holds four groups of three bytes,
+	 * which are spread over 32 bit words and split into 6 bit indices with multiplications.
+	 * The indices are mapped to characters by adding an offset per alphabet range.
+	 */
+	ESTD_TARGET("avx2") inline std::size_t encode_avx2(std::uint8_t const * input, std::size_t size, char * output) {
+		__m256i const spread = _mm256_setr_epi8(
+			1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+			1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10
+		);
+		__m256i const offsets = _mm256_setr_epi8(
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0
+		);
+
+		std::size_t i = 0;
+		char * out = output;
+		// Each lane loads 16 bytes but only uses 12, so stop while 4 more bytes can still be read.
+		for (; i + 28 <= size; i += 24, out += 32) {
+			__m128i low  = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input + i));
+			__m128i high = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input + i + 12));
+			__m256i words = _mm256_shuffle_epi8(_mm256_set_m128i(high, low), spread);
+
+			__m256i odd     = _mm256_mulhi_epu16(_mm256_and_si256(words, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+			__m256i even    = _mm256_mullo_epi16(_mm256_and_si256(words, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+			__m256i indices = _mm256_or_si256(odd, even);
+
+			__m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+			range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+			__m256i chars = _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range));
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(out), chars);
+		}
+		return i;
+	}
+
+	/// Decode 32 characters at a time, returning the number of characters decoded.
+	/**
+	 * Characters are validated with two nibble lookups whose bitwise AND is zero only for the alphabet.
+	 * Stops before the first block with padding or an invalid character, so the scalar code can handle it.
+	 */
+	ESTD_TARGET("avx2") inline std::size_t decode_avx2(char const * input, std::size_t size, std::uint8_t * output) {
+		__m256i const lookup_low = _mm256_setr_epi8(
+			0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+			0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a
+		);
+		__m256i const lookup_high = _mm256_setr_epi8(
+			0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+			0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+		);
+		__m256i const lookup_roll = _mm256_setr_epi8(
+			0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0
+		);
+		__m256i const pack = _mm256_setr_epi8(
+			2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+			2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+		);
+		__m256i const nibble = _mm256_set1_epi8(0x0f);
+
+		std::size_t i = 0;
+		std::uint8_t * out = output;
+		for (; i + 32 <= size; i += 32, out += 24) {
+			__m256i chars = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(input + i));
+			__m256i high  = _mm256_and_si256(_mm256_srli_epi32(chars, 4), nibble);
+			__m256i low   = _mm256_and_si256(chars, nibble);
+			__m256i check = _mm256_and_si256(_mm256_shuffle_epi8(lookup_low, low), _mm256_shuffle_epi8(lookup_high, high));
+			if (!_mm256_testz_si256(check, check)) break;
+
+			__m256i slash  = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('/'));
+			__m256i values = _mm256_add_epi8(chars, _mm256_shuffle_epi8(lookup_roll, _mm256_add_epi8(slash, high)));
+
+			__m256i pairs   = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+			__m256i groups  = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+			__m256i bytes   = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(groups, pack), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 0, 0));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm256_castsi256_si128(bytes));
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(out + 16), _mm256_extracti128_si256(bytes, 1));
+		}
+		return i;
+	}
+#endif
+}
+
+/// Get the length of the padded base64 encoding of a number of bytes.
+constexpr std::size_t base64_encoded_size(std::size_t size) {
+	return (size + 2) / 3 * 4;
+}
+
+/// Encode bytes as padded base64 text into a caller-provided buffer.
+/**
+ * \return The number of characters written, which is always base64_encoded_size(input.size()).
+ * \throws std::length_error if the output is too small.
+ */
+inline std::size_t to_base64(byte_view input, view<char> output) {
+	std::size_t size = base64_encoded_size(input.size());
+	if (output.size() < size) {
+		throw std::length_error("output of size " + std::to_string(output.size()) + " is too small for " + std::to_string(size) + " base64 characters");
+	}
+	std::size_t done = 0;
+#ifdef ESTD_HAVE_X86_DISPATCH
+	if (cpu_has_avx2()) done = detail::base64::encode_avx2(input.data(), input.size(), output.data());
+#endif
+	detail::base64::encode_scalar(input.data() + done, input.size() - done, output.data() + done / 3 * 4);
+	return size;
+}
+
+/// Encode bytes as padded base64 text into a caller-provided byte buffer.
+inline std::size_t to_base64(byte_view input, mut_byte_view output) {
+	return to_base64(input, view<char>{reinterpret_cast<char *>(output.data()), output.size()});
+}
+
+/// Encode bytes as padded base64 text, replacing the contents of a string.
+/**
+ * The string only allocates if its capacity is too small.
+ */
+inline void to_base64(byte_view input, std::string & output) {
+	output.resize(base64_encoded_size(input.size()));
+	to_base64(input, view<char>{output.data(), output.size()});
+}
+
+/// Encode bytes as padded base64 text.
+inline std::string to_base64(byte_view input) {
+	std::string result;
+	to_base64(input, result);
+	return result;
+}
+
+/// Get the number of bytes encoded by padded base64 text.
+/**
+ * Fails with std::errc::invalid_argument if the length of the input is not a multiple of four.
+ */
+inline result<std::size_t, error> base64_decoded_size(std::string_view input) {
+	if (input.size() % 4 != 0) {
+		return error{std::errc::invalid_argument, "base64 input length " + std::to_string(input.size()) + " is not a multiple of 4"};
+	}
+	std::size_t padding = 0;
+	if (input.size() > 0 && input[input.size() - 1] == '=') ++padding;
+	if (input.size() > 1 && input[input.size() - 2] == '=') ++padding;
+	return {in_place_valid, input.size() / 4 * 3 - padding};
+}
+
+/// Decode padded base64 text into a caller-provided buffer.
+/**
+ * Fails with std::errc::invalid_argument if the input is not validly padded or contains a character outside the base64 alphabet,
+ * or with std::errc::no_buffer_space if the output is too small.
+ *
+ * \return The number of bytes written.
+ */
+inline result<std::size_t, error> from_base64(std::string_view input, mut_byte_view output) {
+	result<std::size_t, error> size = base64_decoded_size(input);
+	if (!size) return size;
+	if (output.size() < *size) {
+		return error{std::errc::no_buffer_space, "output of size " + std::to_string(output.size()) + " is too small for " + std::to_string(*size) + " decoded bytes"};
+	}
+
+	std::size_t done = 0;
+#ifdef ESTD_HAVE_X86_DISPATCH
+	if (cpu_has_avx2()) done = detail::base64::decode_avx2(input.data(), input.size(), output.data());
+#endif
+	std::size_t invalid = detail::base64::decode_scalar(input.data() + done, input.size() - done, output.data() + done / 4 * 3);
+	if (invalid != std::size_t(-1)) {
+		return error{std::errc::invalid_argument, "invalid base64 character at offset " + std::to_string(done + invalid)};
+	}
+	return size;
+}
+
+/// Decode padded base64 text into a new byte array.
+inline result<byte_heap_array, error> from_base64(std::string_view input) {
+	result<std::size_t, error> size = base64_decoded_size(input);
+	if (!size) return std::move(size.error_unchecked());
+	byte_heap_array result = byte_heap_array::uninitialized(*size);
+	if (estd::result<std::size_t, error> decoded = from_base64(input, mut_byte_view{result.data(), result.size()}); !decoded) {
+		return std::move(decoded.error_unchecked());
+	}
+	return {in_place_valid, std::move(result)};
+}
+
+template<> struct conversion<byte_view, std::string, base64_encoding> {
+	static std::string perform(byte_view from) {
+		return to_base64(from);
+	}
+};
+
+template<> struct conversion<mut_byte_view, std::string, base64_encoding> : conversion<byte_view, std::string, base64_encoding> {};
+template<> struct conversion<byte_heap_array, std::string, base64_encoding> : conversion<byte_view, std::string, base64_encoding> {};
+
+template<> struct conversion<std::string_view, result<byte_heap_array, error>, base64_encoding> {
+	static result<byte_heap_array, error> perform(std::string_view from) {
+		return from_base64(from);
+	}
+};
+
+template<> struct conversion<std::string, result<byte_heap_array, error>, base64_encoding> : conversion<std::string_view, result<byte_heap_array, error>, base64_encoding> {};
+template<> struct conversion<char const *, result<byte_heap_array, error>, base64_encoding> : conversion<std::string_view, result<byte_heap_array, error>, base64_encoding> {};
+
+}
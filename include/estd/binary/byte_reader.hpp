@@ -0,0 +1,161 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "./endian.hpp"
+#include "../result/error.hpp"
+#include "../result/result.hpp"
+#include "../view/view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace estd {
+
+/// Cursor to parse binary data from a byte view without copying.
+/**
+ * The checked functions return a result and fail with std::errc::message_size
+ * if there is not enough data left. A failed read does not advance the cursor.
+ *
+ * To avoid a bounds check for every field, check the size of a whole message once with `require()`
+ * and then use the `*_unchecked()` functions to parse the fields.
+ */
+class byte_reader {
+private:
+	/// The data being read.
+	byte_view data_;
+
+	/// The read position in the data.
+	std::size_t position_ = 0;
+
+public:
+	/// Create a reader that starts at the beginning of a byte view.
+	explicit byte_reader(byte_view data) : data_{data} {}
+
+	/// Get the whole underlying data.
+	byte_view data() const { return data_; }
+
+	/// Get the current read position.
+	std::size_t position() const { return position_; }
+
+	/// Get the number of bytes left to read.
+	std::size_t remaining() const { return data_.size() - position_; }
+
+	/// Check if all data has been read.
+	bool empty() const { return remaining() == 0; }
+
+	/// Get a view of the data that has not been read yet.
+	byte_view rest() const { return {data_.data() + position_, remaining()}; }
+
+	/// Check that at least `count` bytes are left to read.
+	/**
+	 * After a successful check, up to `count` bytes may be read with the unchecked functions.
+	 */
+	result<void, error> require(std::size_t count) const {
+		if (count > remaining()) {
+			return error{std::errc::message_size, "need " + std::to_string(count) + " bytes at offset " + std::to_string(position_) + ", but only " + std::to_string(remaining()) + " are left"};
+		}
+		return {in_place_valid};
+	}
+
+	/// Read a trivially copyable value in native byte order.
+	template<typename T>
+	result<T, error> read() {
+		if (result<void, error> check = require(sizeof(T)); !check) return std::move(check.error_unchecked());
+		return {in_place_valid, read_unchecked<T>()};
+	}
+
+	/// Read a little endian value.
+	template<typename T>
+	result<T, error> read_le() {
+		if (result<void, error> check = require(sizeof(T)); !check) return std::move(check.error_unchecked());
+		return {in_place_valid, read_le_unchecked<T>()};
+	}
+
+	/// Read a big endian value.
+	template<typename T>
+	result<T, error> read_be() {
+		if (result<void, error> check = require(sizeof(T)); !check) return std::move(check.error_unchecked());
+		return {in_place_valid, read_be_unchecked<T>()};
+	}
+
+	/// Read a number of bytes as a view on the underlying data.
+	result<byte_view, error> read_view(std::size_t count) {
+		if (result<void, error> check = require(count); !check) return std::move(check.error_unchecked());
+		return {in_place_valid, read_view_unchecked(count)};
+	}
+
+	/// Skip a number of bytes.
+	result<void, error> skip(std::size_t count) {
+		if (result<void, error> check = require(count); !check) return check;
+		skip_unchecked(count);
+		return {in_place_valid};
+	}
+
+	/// Read a trivially copyable value in native byte order without bounds checking.
+	template<typename T>
+	T read_unchecked() {
+		static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types can be read from bytes");
+		T value = detail::binary::load<T>(data_.data() + position_);
+		position_ += sizeof(T);
+		return value;
+	}
+
+	/// Read a little endian value without bounds checking.
+	template<typename T>
+	T read_le_unchecked() {
+		T value = detail::binary::load<endian::little, T>(data_.data() + position_);
+		position_ += sizeof(T);
+		return value;
+	}
+
+	/// Read a big endian value without bounds checking.
+	template<typename T>
+	T read_be_unchecked() {
+		T value = detail::binary::load<endian::big, T>(data_.data() + position_);
+		position_ += sizeof(T);
+		return value;
+	}
+
+	/// Read a number of bytes as a view on the underlying data without bounds checking.
+	byte_view read_view_unchecked(std::size_t count) {
+		byte_view result{data_.data() + position_, count};
+		position_ += count;
+		return result;
+	}
+
+	/// Skip a number of bytes without bounds checking.
+	void skip_unchecked(std::size_t count) {
+		position_ += count;
+	}
+};
+
+}
@@ -0,0 +1,299 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "./endian.hpp"
+#include "../heap_array/heap_array.hpp"
+#include "../result/error.hpp"
+#include "../result/result.hpp"
+#include "../view/view.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace estd {
+
+/// Cursor to serialize binary data into a byte buffer.
+/**
+ * A writer either writes into a fixed buffer, or into a growable buffer that it owns.
+ *
+ * When a write does not fit in a fixed buffer, the checked functions fail with std::errc::message_size
+ * and the writer is left unchanged. A growable buffer grows geometrically instead.
+ *
+ * To avoid a capacity check for every field, reserve space for a whole message once with `reserve()`
+ * and then use the `*_unchecked()` functions to write the fields.
+ *
+ * Length prefixes that are only known after writing a message can be reserved with `skip()`
+ * and filled in later with one of the `patch*()` functions.
+ */
+class byte_writer {
+private:
+	/// The owned buffer of a growable writer.
+	/**
+	 * This is a plain byte_heap_array so that take() can hand it out without converting it to another allocator.
+	 * The price is that growing the buffer copies the written bytes to a new allocation instead of using realloc(),
+	 * which is amortized by the geometric growth.
+	 */
+	byte_heap_array owned_;
+
+	/// The buffer being written to.
+	mut_byte_view buffer_;
+
+	/// The write position in the buffer.
+	std::size_t position_ = 0;
+
+	/// True if the writer owns and grows its buffer.
+	bool growable_ = false;
+
+	/// Create a growable writer that takes ownership of a buffer.
+	explicit byte_writer(byte_heap_array && buffer) : owned_{std::move(buffer)}, buffer_{owned_.data(), owned_.size()}, growable_{true} {}
+
+	/// Grow the owned buffer so that at least `count` bytes fit after the write position.
+	/**
+	 * The caller must make sure that `position_ + count` does not overflow.
+	 */
+	void grow(std::size_t count) {
+		constexpr std::size_t max_size = std::numeric_limits<std::size_t>::max();
+		std::size_t doubled = owned_.size() > max_size / 2 ? max_size : 2 * owned_.size();
+		owned_.resize_uninitialized(std::max(position_ + count, doubled));
+		buffer_ = mut_byte_view{owned_.data(), owned_.size()};
+	}
+
+public:
+	/// Create a writer for a fixed buffer.
+	explicit byte_writer(mut_byte_view buffer) : buffer_{buffer} {}
+
+	/// Create a writer with a growable buffer.
+	static byte_writer growable(std::size_t initial_capacity = 256) {
+		return byte_writer{byte_heap_array::uninitialized(initial_capacity)};
+	}
+
+	byte_writer(byte_writer && other) noexcept :
+		owned_{std::move(other.owned_)},
+		buffer_{other.growable_ ? mut_byte_view{owned_.data(), owned_.size()} : other.buffer_},
+		position_{std::exchange(other.position_, 0)},
+		growable_{other.growable_}
+	{
+		other.buffer_ = mut_byte_view{nullptr, nullptr};
+	}
+
+	byte_writer & operator=(byte_writer && other) noexcept {
+		if (&other == this) return *this;
+		owned_    = std::move(other.owned_);
+		buffer_   = other.growable_ ? mut_byte_view{owned_.data(), owned_.size()} : other.buffer_;
+		position_ = std::exchange(other.position_, 0);
+		growable_ = other.growable_;
+		other.buffer_ = mut_byte_view{nullptr, nullptr};
+		return *this;
+	}
+
+	/// Check if the writer owns and grows its buffer.
+	bool is_growable() const { return growable_; }
+
+	/// Get the current write position, which is also the number of bytes written.
+	std::size_t position() const { return position_; }
+
+	/// Get the current size of the buffer.
+	std::size_t capacity() const { return buffer_.size(); }
+
+	/// Get the number of bytes that can be written without growing the buffer.
+	std::size_t remaining() const { return capacity() - position_; }
+
+	/// Get a view of the bytes written so far.
+	/**
+	 * The view is invalidated when a growable writer grows its buffer.
+	 */
+	byte_view written() const { return {buffer_.data(), position_}; }
+
+	/// Make sure at least `count` more bytes can be written.
+	/**
+	 * A growable writer grows its buffer if needed.
+	 * It fails with std::errc::message_size if the total size would not fit in a std::size_t.
+	 * A fixed writer fails with std::errc::message_size if the bytes do not fit.
+	 *
+	 * After a successful call, up to `count` bytes may be written with the unchecked functions.
+	 */
+	result<void, error> reserve(std::size_t count) {
+		if (count <= remaining()) return {in_place_valid};
+		if (growable_) {
+			if (count > std::numeric_limits<std::size_t>::max() - position_) {
+				return error{std::errc::message_size, "can not reserve " + std::to_string(count) + " bytes at offset " + std::to_string(position_) + ", the total size overflows"};
+			}
+			grow(count);
+			return {in_place_valid};
+		}
+		return error{std::errc::message_size, "need " + std::to_string(count) + " bytes at offset " + std::to_string(position_) + ", but only " + std::to_string(remaining()) + " are left"};
+	}
+
+	/// Write a trivially copyable value in native byte order.
+	template<typename T>
+	result<void, error> write(T const & value) {
+		if (result<void, error> check = reserve(sizeof(T)); !check) return check;
+		write_unchecked(value);
+		return {in_place_valid};
+	}
+
+	/// Write a value in little endian byte order.
+	template<typename T>
+	result<void, error> write_le(T value) {
+		if (result<void, error> check = reserve(sizeof(T)); !check) return check;
+		write_le_unchecked(value);
+		return {in_place_valid};
+	}
+
+	/// Write a value in big endian byte order.
+	template<typename T>
+	result<void, error> write_be(T value) {
+		if (result<void, error> check = reserve(sizeof(T)); !check) return check;
+		write_be_unchecked(value);
+		return {in_place_valid};
+	}
+
+	/// Write a range of bytes.
+	result<void, error> write_view(byte_view data) {
+		if (result<void, error> check = reserve(data.size()); !check) return check;
+		write_view_unchecked(data);
+		return {in_place_valid};
+	}
+
+	/// Reserve zero-filled space in the output, to be filled in later.
+	/**
+	 * \return The offset of the reserved space, to be passed to one of the `patch*()` functions.
+	 */
+	result<std::size_t, error> skip(std::size_t count) {
+		if (result<void, error> check = reserve(count); !check) return std::move(check.error_unchecked());
+		return {in_place_valid, skip_unchecked(count)};
+	}
+
+	/// Write a trivially copyable value in native byte order without checking the capacity.
+	template<typename T>
+	void write_unchecked(T const & value) {
+		static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types can be written as bytes");
+		detail::binary::store(buffer_.data() + position_, value);
+		position_ += sizeof(T);
+	}
+
+	/// Write a value in little endian byte order without checking the capacity.
+	template<typename T>
+	void write_le_unchecked(T value) {
+		detail::binary::store<endian::little>(buffer_.data() + position_, value);
+		position_ += sizeof(T);
+	}
+
+	/// Write a value in big endian byte order without checking the capacity.
+	template<typename T>
+	void write_be_unchecked(T value) {
+		detail::binary::store<endian::big>(buffer_.data() + position_, value);
+		position_ += sizeof(T);
+	}
+
+	/// Write a range of bytes without checking the capacity.
+	void write_view_unchecked(byte_view data) {
+		if (data.size() > 0) std::memcpy(buffer_.data() + position_, data.data(), data.size());
+		position_ += data.size();
+	}
+
+	/// Reserve zero-filled space in the output without checking the capacity.
+	/**
+	 * \return The offset of the reserved space.
+	 */
+	std::size_t skip_unchecked(std::size_t count) {
+		std::size_t offset = position_;
+		if (count > 0) std::memset(buffer_.data() + position_, 0, count);
+		position_ += count;
+		return offset;
+	}
+
+	/// Overwrite a previously written value in native byte order.
+	/**
+	 * \throws std::range_error if the value does not fit in the written bytes.
+	 */
+	template<typename T>
+	void patch(std::size_t offset, T const & value) {
+		check_patch(offset, sizeof(T));
+		detail::binary::store(buffer_.data() + offset, value);
+	}
+
+	/// Overwrite a previously written value in little endian byte order.
+	/**
+	 * \throws std::range_error if the value does not fit in the written bytes.
+	 */
+	template<typename T>
+	void patch_le(std::size_t offset, T value) {
+		check_patch(offset, sizeof(T));
+		detail::binary::store<endian::little>(buffer_.data() + offset, value);
+	}
+
+	/// Overwrite a previously written value in big endian byte order.
+	/**
+	 * \throws std::range_error if the value does not fit in the written bytes.
+	 */
+	template<typename T>
+	void patch_be(std::size_t offset, T value) {
+		check_patch(offset, sizeof(T));
+		detail::binary::store<endian::big>(buffer_.data() + offset, value);
+	}
+
+	/// Take the owned buffer of a growable writer, shrunk to the written bytes.
+	/**
+	 * If the buffer is exactly full, it is handed out without copying.
+	 * Otherwise the written bytes are copied once into an allocation of the right size,
+	 * because a byte_heap_array can not be shrunk in place.
+	 * To avoid that copy, create the writer with the exact size of the message if it is known up front.
+	 *
+	 * The writer is left empty, and can be used to write a new message.
+	 *
+	 * \throws std::logic_error if the writer is not growable.
+	 */
+	byte_heap_array take() {
+		if (!growable_) throw std::logic_error("attempted to take the buffer of a fixed size byte_writer");
+		owned_.shrink_to(position_);
+		byte_heap_array result = std::move(owned_);
+		owned_    = byte_heap_array{};
+		buffer_   = mut_byte_view{nullptr, nullptr};
+		position_ = 0;
+		return result;
+	}
+
+private:
+	void check_patch(std::size_t offset, std::size_t size) const {
+		if (offset > position_ || size > position_ - offset) {
+			throw std::range_error("can not patch " + std::to_string(size) + " bytes at offset " + std::to_string(offset) + ", only " + std::to_string(position_) + " bytes have been written");
+		}
+	}
+};
+
+}
@@ -0,0 +1,103 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace estd {
+
+/// The byte order of the CPU running the program.
+enum class endian {
+	little,
+	big,
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	native = big,
+#else
+	native = little,
+#endif
+};
+
+/// True if a type can be read and written with an explicit byte order.
+template<typename T>
+constexpr bool is_endian_convertible = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+/// Reverse the bytes of an arithmetic or enum value.
+template<typename T>
+T byteswap(T value) {
+	static_assert(is_endian_convertible<T>, "only arithmetic and enum types can be byte swapped");
+	if constexpr (sizeof(T) == 1) {
+		return value;
+	} else {
+		using word = std::conditional_t<sizeof(T) == 2, std::uint16_t, std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>;
+		static_assert(sizeof(word) == sizeof(T), "unsupported type size for byteswap");
+		word bits;
+		std::memcpy(&bits, &value, sizeof(T));
+		if constexpr (sizeof(T) == 2) bits = __builtin_bswap16(bits);
+		if constexpr (sizeof(T) == 4) bits = __builtin_bswap32(bits);
+		if constexpr (sizeof(T) == 8) bits = __builtin_bswap64(bits);
+		std::memcpy(&value, &bits, sizeof(T));
+		return value;
+	}
+}
+
+namespace detail::binary {
+	/// Load a value from possibly unaligned memory in native byte order.
+	template<typename T>
+	T load(std::uint8_t const * data) {
+		T value;
+		std::memcpy(&value, data, sizeof(T));
+		return value;
+	}
+
+	/// Load a value from possibly unaligned memory in the given byte order.
+	template<endian Order, typename T>
+	T load(std::uint8_t const * data) {
+		T value = load<T>(data);
+		if constexpr (Order != endian::native) value = byteswap(value);
+		return value;
+	}
+
+	/// Store a value to possibly unaligned memory in native byte order.
+	template<typename T>
+	void store(std::uint8_t * data, T const & value) {
+		std::memcpy(data, &value, sizeof(T));
+	}
+
+	/// Store a value to possibly unaligned memory in the given byte order.
+	template<endian Order, typename T>
+	void store(std::uint8_t * data, T value) {
+		if constexpr (Order != endian::native) value = byteswap(value);
+		store(data, value);
+	}
+}
+
+}
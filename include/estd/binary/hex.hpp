@@ -0,0 +1,235 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "../array/initialize.hpp"
+#include "../convert/convert.hpp"
+#include "../heap_array/heap_array.hpp"
+#include "../result/error.hpp"
+#include "../result/result.hpp"
+#include "../utility/cpu_features.hpp"
+#include "../view/view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+#  include <immintrin.h>
+#endif
+
+namespace estd {
+
+/// Conversion tag to encode bytes as hexadecimal text and to decode them again.
+/**
+ * Use as `estd::convert<std::string, estd::hex_encoding>(bytes)`
+ * or `estd::parse<estd::byte_heap_array, estd::error, estd::hex_encoding>(text)`.
+ */
+struct hex_encoding {};
+
+namespace detail::hex {
+	constexpr char digits[] = "0123456789abcdef";
+
+	/// The value of each hex digit, or 0xff for characters that are not hex digits.
+	inline constexpr std::array<std::uint8_t, 256> values = make_array<256>([] (std::size_t c) -> std::uint8_t {
+		if (c >= '0' && c <= '9') return std::uint8_t(c - '0');
+		if (c >= 'a' && c <= 'f') return std::uint8_t(c - 'a' + 10);
+		if (c >= 'A' && c <= 'F') return std::uint8_t(c - 'A' + 10);
+		return 0xff;
+	});
+
+	inline void encode_scalar(std::uint8_t const * input, std::size_t size, char * output) {
+		for (std::size_t i = 0; i < size; ++i) {
+			output[2 * i]     = digits[input[i] >> 4];
+			output[2 * i + 1] = digits[input[i] & 0x0f];
+		}
+	}
+
+	/// Decode pairs of hex digits, returning the index of the first invalid character or npos.
+	inline std::size_t decode_scalar(char const * input, std::size_t size, std::uint8_t * output) {
+		for (std::size_t i = 0; i + 1 < size; i += 2) {
+			std::uint8_t high = values[std::uint8_t(input[i])];
+			std::uint8_t low  = values[std::uint8_t(input[i + 1])];
+			if (high == 0xff) return i;
+			if (low  == 0xff) return i + 1;
+			output[i / 2] = std::uint8_t(high << 4 | low);
+		}
+		return std::size_t(-1);
+	}
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+	/// Encode 16 bytes at a time, returning the number of bytes encoded.
+	ESTD_TARGET("avx2") inline std::size_t encode_avx2(std::uint8_t const * input, std::size_t size, char * output) {
+		__m256i const table  = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(digits)));
+		__m128i const nibble = _mm_set1_epi8(0x0f);
+		std::size_t i = 0;
+		for (; i + 16 <= size; i += 16) {
+			__m128i bytes = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input + i));
+			__m128i high  = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble);
+			__m128i low   = _mm_and_si128(bytes, nibble);
+			__m256i pairs = _mm256_set_m128i(_mm_unpackhi_epi8(high, low), _mm_unpacklo_epi8(high, low));
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + 2 * i), _mm256_shuffle_epi8(table, pairs));
+		}
+		return i;
+	}
+
+	/// Decode 32 digits at a time, returning the number of digits decoded.
+	/**
+	 * Stops before the first block with an invalid character, so the scalar code can report its position.
+	 */
+	ESTD_TARGET("avx2") inline std::size_t decode_avx2(char const * input, std::size_t size, std::uint8_t * output) {
+		__m256i const zero_char  = _mm256_set1_epi8('0');
+		__m256i const lower_a    = _mm256_set1_epi8('a');
+		__m256i const case_bit   = _mm256_set1_epi8(0x20);
+		__m256i const nine       = _mm256_set1_epi8(9);
+		__m256i const five       = _mm256_set1_epi8(5);
+		__m256i const ten        = _mm256_set1_epi8(10);
+		__m256i const weights    = _mm256_set1_epi16(0x0110);
+		std::size_t i = 0;
+		for (; i + 32 <= size; i += 32) {
+			__m256i chars    = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(input + i));
+			__m256i digit    = _mm256_sub_epi8(chars, zero_char);
+			__m256i letter   = _mm256_sub_epi8(_mm256_or_si256(chars, case_bit), lower_a);
+			__m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, nine), digit);
+			__m256i is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, five), letter);
+			if (std::uint32_t(_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha))) != 0xffffffffu) break;
+
+			__m256i value   = _mm256_blendv_epi8(_mm256_add_epi8(letter, ten), digit, is_digit);
+			__m256i bytes   = _mm256_maddubs_epi16(value, weights);
+			__m256i packed  = _mm256_permute4x64_epi64(_mm256_packus_epi16(bytes, bytes), 0x08);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(output + i / 2), _mm256_castsi256_si128(packed));
+		}
+		return i;
+	}
+#endif
+}
+
+/// Get the length of the hex encoding of a number of bytes.
+constexpr std::size_t hex_encoded_size(std::size_t size) {
+	return 2 * size;
+}
+
+/// Encode bytes as lowercase hexadecimal text into a caller-provided buffer.
+/**
+ * \return The number of characters written, which is always hex_encoded_size(input.size()).
+ * \throws std::length_error if the output is too small.
+ */
+inline std::size_t to_hex(byte_view input, view<char> output) {
+	std::size_t size = hex_encoded_size(input.size());
+	if (output.size() < size) {
+		throw std::length_error("output of size " + std::to_string(output.size()) + " is too small for " + std::to_string(size) + " hex digits");
+	}
+	std::size_t done = 0;
+#ifdef ESTD_HAVE_X86_DISPATCH
+	if (cpu_has_avx2()) done = detail::hex::encode_avx2(input.data(), input.size(), output.data());
+#endif
+	detail::hex::encode_scalar(input.data() + done, input.size() - done, output.data() + 2 * done);
+	return size;
+}
+
+/// Encode bytes as lowercase hexadecimal text into a caller-provided byte buffer.
+inline std::size_t to_hex(byte_view input, mut_byte_view output) {
+	return to_hex(input, view<char>{reinterpret_cast<char *>(output.data()), output.size()});
+}
+
+/// Encode bytes as lowercase hexadecimal text, replacing the contents of a string.
+/**
+ * The string only allocates if its capacity is too small.
+ */
+inline void to_hex(byte_view input, std::string & output) {
+	output.resize(hex_encoded_size(input.size()));
+	to_hex(input, view<char>{output.data(), output.size()});
+}
+
+/// Encode bytes as lowercase hexadecimal text.
+inline std::string to_hex(byte_view input) {
+	std::string result;
+	to_hex(input, result);
+	return result;
+}
+
+/// Decode hexadecimal text into a caller-provided buffer.
+/**
+ * Both uppercase and lowercase digits are accepted.
+ *
+ * Fails with std::errc::invalid_argument if the input has an odd length or contains a character that is not a hex digit,
+ * or with std::errc::no_buffer_space if the output is too small.
+ *
+ * \return The number of bytes written.
+ */
+inline result<std::size_t, error> from_hex(std::string_view input, mut_byte_view output) {
+	if (input.size() % 2 != 0) {
+		return error{std::errc::invalid_argument, "hex input has odd length " + std::to_string(input.size())};
+	}
+	std::size_t size = input.size() / 2;
+	if (output.size() < size) {
+		return error{std::errc::no_buffer_space, "output of size " + std::to_string(output.size()) + " is too small for " + std::to_string(size) + " decoded bytes"};
+	}
+
+	std::size_t done = 0;
+#ifdef ESTD_HAVE_X86_DISPATCH
+	if (cpu_has_avx2()) done = detail::hex::decode_avx2(input.data(), input.size(), output.data());
+#endif
+	std::size_t invalid = detail::hex::decode_scalar(input.data() + done, input.size() - done, output.data() + done / 2);
+	if (invalid != std::size_t(-1)) {
+		return error{std::errc::invalid_argument, "invalid hex digit at offset " + std::to_string(done + invalid)};
+	}
+	return {in_place_valid, size};
+}
+
+/// Decode hexadecimal text into a new byte array.
+inline result<byte_heap_array, error> from_hex(std::string_view input) {
+	byte_heap_array result = byte_heap_array::uninitialized(input.size() / 2);
+	if (estd::result<std::size_t, error> decoded = from_hex(input, mut_byte_view{result.data(), result.size()}); !decoded) {
+		return std::move(decoded.error_unchecked());
+	}
+	return {in_place_valid, std::move(result)};
+}
+
+template<> struct conversion<byte_view, std::string, hex_encoding> {
+	static std::string perform(byte_view from) {
+		return to_hex(from);
+	}
+};
+
+template<> struct conversion<mut_byte_view, std::string, hex_encoding> : conversion<byte_view, std::string, hex_encoding> {};
+template<> struct conversion<byte_heap_array, std::string, hex_encoding> : conversion<byte_view, std::string, hex_encoding> {};
+
+template<> struct conversion<std::string_view, result<byte_heap_array, error>, hex_encoding> {
+	static result<byte_heap_array, error> perform(std::string_view from) {
+		return from_hex(from);
+	}
+};
+
+template<> struct conversion<std::string, result<byte_heap_array, error>, hex_encoding> : conversion<std::string_view, result<byte_heap_array, error>, hex_encoding> {};
+template<> struct conversion<char const *, result<byte_heap_array, error>, hex_encoding> : conversion<std::string_view, result<byte_heap_array, error>, hex_encoding> {};
+
+}
@@ -0,0 +1,196 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "../array/initialize.hpp"
+#include "../utility/cpu_features.hpp"
+#include "../view/view.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+#  include <immintrin.h>
+#endif
+
+namespace estd {
+
+namespace detail::crc32c {
+	/// The reflected Castagnoli polynomial.
+	constexpr std::uint32_t polynomial = 0x82F63B78;
+
+	/// A linear operator on 32 bit CRC values over GF(2), stored as one column per bit.
+	using gf2_matrix = std::array<std::uint32_t, 32>;
+
+	constexpr std::uint32_t gf2_times(gf2_matrix const & matrix, std::uint32_t vector) {
+		std::uint32_t result = 0;
+		for (std::size_t i = 0; vector; ++i, vector >>= 1) {
+			if (vector & 1) result ^= matrix[i];
+		}
+		return result;
+	}
+
+	constexpr gf2_matrix gf2_square(gf2_matrix const & matrix) {
+		return make_array<32>([&matrix] (std::size_t i) { return gf2_times(matrix, matrix[i]); });
+	}
+
+	/// Get the operator that appends a power-of-two number of zero bytes to a CRC.
+	constexpr gf2_matrix zeros_operator(std::size_t length) {
+		// Start with the operator for a single zero bit and square up to one zero byte.
+		gf2_matrix odd  = make_array<32>([] (std::size_t i) { return i == 0 ? polynomial : std::uint32_t(1) << (i - 1); });
+		gf2_matrix even = gf2_square(odd);
+		odd = gf2_square(even);
+		while (true) {
+			even = gf2_square(odd);
+			length >>= 1;
+			if (length == 0) return even;
+			odd = gf2_square(even);
+			length >>= 1;
+			if (length == 0) return odd;
+		}
+	}
+
+	/// Lookup tables to apply a zeros operator a byte at a time.
+	using shift_table = std::array<std::array<std::uint32_t, 256>, 4>;
+
+	constexpr shift_table make_shift_table(std::size_t length) {
+		gf2_matrix op = zeros_operator(length);
+		return make_array<4>([&op] (std::size_t k) {
+			return make_array<256>([&op, k] (std::size_t n) { return gf2_times(op, std::uint32_t(n) << (8 * k)); });
+		});
+	}
+
+	/// Append the zero bytes of a shift table to a CRC.
+	inline std::uint32_t shift(shift_table const & table, std::uint32_t crc) {
+		return table[0][crc & 0xff] ^ table[1][(crc >> 8) & 0xff] ^ table[2][(crc >> 16) & 0xff] ^ table[3][crc >> 24];
+	}
+
+	/// Get the CRC of a single byte followed by `zeros` zero bytes.
+	constexpr std::uint32_t byte_crc(std::uint32_t byte, std::size_t zeros) {
+		std::uint32_t crc = byte;
+		for (std::size_t i = 0; i < 8 * (zeros + 1); ++i) crc = crc & 1 ? (crc >> 1) ^ polynomial : crc >> 1;
+		return crc;
+	}
+
+	/// Tables for the slicing-by-8 software implementation.
+	inline constexpr std::array<std::array<std::uint32_t, 256>, 8> slice_table = make_array<8>([] (std::size_t k) {
+		return make_array<256>([k] (std::size_t n) { return byte_crc(std::uint32_t(n), k); });
+	});
+
+	inline std::uint32_t software(std::uint32_t crc, std::uint8_t const * data, std::size_t size) {
+		std::size_t i = 0;
+		for (; i + 8 <= size; i += 8) {
+			std::uint32_t low  = std::uint32_t(data[i + 0]) | std::uint32_t(data[i + 1]) << 8 | std::uint32_t(data[i + 2]) << 16 | std::uint32_t(data[i + 3]) << 24;
+			low ^= crc;
+			crc = slice_table[7][low & 0xff] ^ slice_table[6][(low >> 8) & 0xff] ^ slice_table[5][(low >> 16) & 0xff] ^ slice_table[4][low >> 24]
+				^ slice_table[3][data[i + 4]] ^ slice_table[2][data[i + 5]] ^ slice_table[1][data[i + 6]] ^ slice_table[0][data[i + 7]];
+		}
+		for (; i < size; ++i) crc = (crc >> 8) ^ slice_table[0][(crc ^ data[i]) & 0xff];
+		return crc;
+	}
+
+	/// Block sizes for the interleaved hardware implementation.
+	/**
+	 * The crc32 instruction has a latency of three cycles but a throughput of one per cycle,
+	 * so three independent blocks are processed at once and combined afterwards.
+	 */
+	constexpr std::size_t long_block  = 8192;
+	constexpr std::size_t short_block = 256;
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+	inline constexpr shift_table long_shift  = make_shift_table(long_block);
+	inline constexpr shift_table short_shift = make_shift_table(short_block);
+
+	/// Update a checksum with eight bytes.
+	/**
+	 * The 64 bit crc32 instruction only exists on x86-64, so 32 bit x86 uses two 32 bit steps.
+	 */
+	ESTD_TARGET("sse4.2") inline std::uint64_t crc_step(std::uint64_t crc, std::uint8_t const * data) {
+#if defined(__x86_64__)
+		std::uint64_t word;
+		std::memcpy(&word, data, sizeof(word));
+		return _mm_crc32_u64(crc, word);
+#else
+		std::uint32_t low;
+		std::uint32_t high;
+		std::memcpy(&low, data, sizeof(low));
+		std::memcpy(&high, data + 4, sizeof(high));
+		return _mm_crc32_u32(_mm_crc32_u32(std::uint32_t(crc), low), high);
+#endif
+	}
+
+	ESTD_TARGET("sse4.2") inline std::uint32_t hardware_interleaved(std::uint32_t crc, std::uint8_t const * & data, std::size_t & size, std::size_t block, shift_table const & table) {
+		while (size >= 3 * block) {
+			std::uint64_t crc0 = crc;
+			std::uint64_t crc1 = 0;
+			std::uint64_t crc2 = 0;
+			for (std::size_t i = 0; i < block; i += 8) {
+				crc0 = crc_step(crc0, data + i);
+				crc1 = crc_step(crc1, data + block + i);
+				crc2 = crc_step(crc2, data + 2 * block + i);
+			}
+			crc = shift(table, std::uint32_t(crc0)) ^ std::uint32_t(crc1);
+			crc = shift(table, crc) ^ std::uint32_t(crc2);
+			data += 3 * block;
+			size -= 3 * block;
+		}
+		return crc;
+	}
+
+	ESTD_TARGET("sse4.2") inline std::uint32_t hardware(std::uint32_t crc, std::uint8_t const * data, std::size_t size) {
+		crc = hardware_interleaved(crc, data, size, long_block, long_shift);
+		crc = hardware_interleaved(crc, data, size, short_block, short_shift);
+		std::uint64_t crc64 = crc;
+		for (; size >= 8; data += 8, size -= 8) crc64 = crc_step(crc64, data);
+		crc = std::uint32_t(crc64);
+		for (; size > 0; ++data, --size) crc = _mm_crc32_u8(crc, *data);
+		return crc;
+	}
+#endif
+}
+
+/// Compute the CRC-32C (Castagnoli) checksum of a range of bytes.
+/**
+ * To checksum data in chunks, pass the result for the previous chunks as `crc`.
+ * The result is the same as computing the checksum over all chunks at once.
+ *
+ * Uses the SSE4.2 crc32 instruction if the CPU supports it,
+ * and a table driven implementation otherwise.
+ */
+inline std::uint32_t crc32c(byte_view data, std::uint32_t crc = 0) {
+	crc = ~crc;
+#ifdef ESTD_HAVE_X86_DISPATCH
+	if (cpu_has_sse42()) return ~detail::crc32c::hardware(crc, data.data(), data.size());
+#endif
+	return ~detail::crc32c::software(crc, data.data(), data.size());
+}
+
+}
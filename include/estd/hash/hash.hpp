@@ -0,0 +1,573 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "../utility/cpu_features.hpp"
+#include "../view/view.hpp"
+#include "../heap_array/heap_array.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+#  include <immintrin.h>
+#endif
+
+namespace estd {
+
+/// True if the elements of a view can be hashed by their object representation.
+/**
+ * This requires that equal values have equal bytes,
+ * which excludes types with padding and floating point types.
+ */
+template<typename T>
+constexpr bool is_byte_hashable = std::is_trivially_copyable_v<T> && std::has_unique_object_representations_v<T>;
+
+namespace detail::hash {
+	constexpr std::uint32_t prime32_1 = 0x9E3779B1U;
+	constexpr std::uint32_t prime32_2 = 0x85EBCA77U;
+	constexpr std::uint32_t prime32_3 = 0xC2B2AE3DU;
+
+	constexpr std::uint64_t prime64_1 = 0x9E3779B185EBCA87ULL;
+	constexpr std::uint64_t prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+	constexpr std::uint64_t prime64_3 = 0x165667B19E3779F9ULL;
+	constexpr std::uint64_t prime64_4 = 0x85EBCA77C2B2AE63ULL;
+	constexpr std::uint64_t prime64_5 = 0x27D4EB2F165667C5ULL;
+
+	constexpr std::uint64_t prime_mx1 = 0x165667919E3779F9ULL;
+	constexpr std::uint64_t prime_mx2 = 0x9FB21C651E98DF25ULL;
+
+	/// The size of a stripe that is mixed into the accumulators in one step.
+	constexpr std::size_t stripe_size = 64;
+
+	/// The number of secret bytes consumed per stripe.
+	constexpr std::size_t secret_consume_rate = 8;
+
+	/// The size of the secret.
+	constexpr std::size_t secret_size = 192;
+
+	/// The number of stripes in a block, after which the accumulators are scrambled.
+	constexpr std::size_t stripes_per_block = (secret_size - stripe_size) / secret_consume_rate;
+
+	/// Inputs up to this size are hashed without the accumulators.
+	constexpr std::size_t midsize_max = 240;
+
+	/// The default secret of XXH3.
+	alignas(64) inline constexpr std::uint8_t default_secret[secret_size] = {
+		0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+		0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+		0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+		0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+		0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+		0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+		0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+		0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+		0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+		0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+		0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+		0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+	};
+
+	constexpr std::uint64_t rotl(std::uint64_t value, int shift) {
+		return (value << shift) | (value >> (64 - shift));
+	}
+
+	inline std::uint64_t read64(std::uint8_t const * data) {
+		std::uint64_t result;
+		std::memcpy(&result, data, sizeof(result));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		result = __builtin_bswap64(result);
+#endif
+		return result;
+	}
+
+	inline std::uint32_t read32(std::uint8_t const * data) {
+		std::uint32_t result;
+		std::memcpy(&result, data, sizeof(result));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		result = __builtin_bswap32(result);
+#endif
+		return result;
+	}
+
+	inline void write64(std::uint8_t * data, std::uint64_t value) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		value = __builtin_bswap64(value);
+#endif
+		std::memcpy(data, &value, sizeof(value));
+	}
+
+	/// Multiply two 64 bit values into a 128 bit product and fold it back to 64 bits with xor.
+	inline std::uint64_t mul128_fold64(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+		__extension__ using uint128 = unsigned __int128;
+		uint128 product = uint128(a) * b;
+		return std::uint64_t(product) ^ std::uint64_t(product >> 64);
+#else
+		std::uint64_t lo_lo = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+		std::uint64_t hi_lo = (a >> 32) * (b & 0xFFFFFFFF);
+		std::uint64_t lo_hi = (a & 0xFFFFFFFF) * (b >> 32);
+		std::uint64_t hi_hi = (a >> 32) * (b >> 32);
+		std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+		std::uint64_t upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+		std::uint64_t lower = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+		return lower ^ upper;
+#endif
+	}
+
+	constexpr std::uint64_t xxh64_avalanche(std::uint64_t hash) {
+		hash ^= hash >> 33;
+		hash *= prime64_2;
+		hash ^= hash >> 29;
+		hash *= prime64_3;
+		hash ^= hash >> 32;
+		return hash;
+	}
+
+	constexpr std::uint64_t avalanche(std::uint64_t hash) {
+		hash ^= hash >> 37;
+		hash *= prime_mx1;
+		hash ^= hash >> 32;
+		return hash;
+	}
+
+	constexpr std::uint64_t rrmxmx(std::uint64_t hash, std::uint64_t size) {
+		hash ^= rotl(hash, 49) ^ rotl(hash, 24);
+		hash *= prime_mx2;
+		hash ^= (hash >> 35) + size;
+		hash *= prime_mx2;
+		return hash ^ (hash >> 28);
+	}
+
+	inline std::uint64_t hash_1to3(std::uint8_t const * input, std::size_t size, std::uint8_t const * secret, std::uint64_t seed) {
+		std::uint32_t combined = (std::uint32_t(input[0]) << 16) | (std::uint32_t(input[size >> 1]) << 24) | std::uint32_t(input[size - 1]) | (std::uint32_t(size) << 8);
+		std::uint64_t bitflip  = (read32(secret) ^ read32(secret + 4)) + seed;
+		return xxh64_avalanche(combined ^ bitflip);
+	}
+
+	inline std::uint64_t hash_4to8(std::uint8_t const * input, std::size_t size, std::uint8_t const * secret, std::uint64_t seed) {
+		seed ^= std::uint64_t(__builtin_bswap32(std::uint32_t(seed))) << 32;
+		std::uint64_t bitflip = (read64(secret + 8) ^ read64(secret + 16)) - seed;
+		std::uint64_t value   = read32(input + size - 4) + (std::uint64_t(read32(input)) << 32);
+		return rrmxmx(value ^ bitflip, size);
+	}
+
+	inline std::uint64_t hash_9to16(std::uint8_t const * input, std::size_t size, std::uint8_t const * secret, std::uint64_t seed) {
+		std::uint64_t bitflip1 = (read64(secret + 24) ^ read64(secret + 32)) + seed;
+		std::uint64_t bitflip2 = (read64(secret + 40) ^ read64(secret + 48)) - seed;
+		std::uint64_t low      = read64(input) ^ bitflip1;
+		std::uint64_t high     = read64(input + size - 8) ^ bitflip2;
+		return avalanche(size + __builtin_bswap64(low) + high + mul128_fold64(low, high));
+	}
+
+	inline std::uint64_t hash_0to16(std::uint8_t const * input, std::size_t size, std::uint8_t const * secret, std::uint64_t seed) {
+		if (size > 8) return hash_9to16(input, size, secret, seed);
+		if (size >= 4) return hash_4to8(input, size, secret, seed);
+		if (size > 0) return hash_1to3(input, size, secret, seed);
+		return xxh64_avalanche(seed ^ (read64(secret + 56) ^ read64(secret + 64)));
+	}
+
+	inline std::uint64_t mix16(std::uint8_t const * input, std::uint8_t const * secret, std::uint64_t seed) {
+		return mul128_fold64(read64(input) ^ (read64(secret) + seed), read64(input + 8) ^ (read64(secret + 8) - seed));
+	}
+
+	inline std::uint64_t hash_17to128(std::uint8_t const * input, std::size_t size, std::uint8_t const * secret, std::uint64_t seed) {
+		std::uint64_t result = size * prime64_1;
+		if (size > 32) {
+			if (size > 64) {
+				if (size > 96) {
+					result += mix16(input + 48, secret + 96, seed);
+					result += mix16(input + size - 64, secret + 112, seed);
+				}
+				result += mix16(input + 32, secret + 64, seed);
+				result += mix16(input + size - 48, secret + 80, seed);
+			}
+			result += mix16(input + 16, secret + 32, seed);
+			result += mix16(input + size - 32, secret + 48, seed);
+		}
+		result += mix16(input, secret, seed);
+		result += mix16(input + size - 16, secret + 16, seed);
+		return avalanche(result);
+	}
+
+	inline std::uint64_t hash_129to240(std::uint8_t const * input, std::size_t size, std::uint8_t const * secret, std::uint64_t seed) {
+		std::uint64_t result = size * prime64_1;
+		for (std::size_t i = 0; i < 8; ++i) result += mix16(input + 16 * i, secret + 16 * i, seed);
+		result = avalanche(result);
+
+		std::uint64_t tail = mix16(input + size - 16, secret + 136 - 17, seed);
+		for (std::size_t i = 8; i < size / 16; ++i) tail += mix16(input + 16 * i, secret + 16 * (i - 8) + 3, seed);
+		return avalanche(result + tail);
+	}
+
+	/// Mix a number of stripes into the accumulators, with a different part of the secret for each stripe.
+	inline void accumulate_scalar(std::uint64_t * accumulators, std::uint8_t const * input, std::uint8_t const * secret, std::size_t stripes) {
+		for (std::size_t stripe = 0; stripe < stripes; ++stripe) {
+			std::uint8_t const * data = input + stripe * stripe_size;
+			std::uint8_t const * key  = secret + stripe * secret_consume_rate;
+			for (std::size_t i = 0; i < 8; ++i) {
+				std::uint64_t value = read64(data + 8 * i);
+				std::uint64_t keyed = value ^ read64(key + 8 * i);
+				accumulators[i ^ 1] += value;
+				accumulators[i]     += (keyed & 0xFFFFFFFF) * (keyed >> 32);
+			}
+		}
+	}
+
+	/// Scramble the accumulators at the end of a block.
+	inline void scramble_scalar(std::uint64_t * accumulators, std::uint8_t const * secret) {
+		for (std::size_t i = 0; i < 8; ++i) {
+			std::uint64_t value = accumulators[i];
+			value ^= value >> 47;
+			value ^= read64(secret + 8 * i);
+			accumulators[i] = value * prime32_1;
+		}
+	}
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+	/// Mix a number of stripes into the accumulators using AVX2, two 32 byte halves per stripe.
+	ESTD_TARGET("avx2") inline void accumulate_avx2(std::uint64_t * accumulators, std::uint8_t const * input, std::uint8_t const * secret, std::size_t stripes) {
+		__m256i low  = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(accumulators));
+		__m256i high = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(accumulators + 4));
+		for (std::size_t stripe = 0; stripe < stripes; ++stripe) {
+			auto const * data = reinterpret_cast<__m256i const *>(input + stripe * stripe_size);
+			auto const * key  = reinterpret_cast<__m256i const *>(secret + stripe * secret_consume_rate);
+
+			__m256i data_low  = _mm256_loadu_si256(data);
+			__m256i data_high = _mm256_loadu_si256(data + 1);
+			__m256i keyed_low  = _mm256_xor_si256(data_low, _mm256_loadu_si256(key));
+			__m256i keyed_high = _mm256_xor_si256(data_high, _mm256_loadu_si256(key + 1));
+
+			// Multiply the low and high 32 bits of each keyed lane, and add the data with adjacent lanes swapped.
+			__m256i product_low  = _mm256_mul_epu32(keyed_low, _mm256_srli_epi64(keyed_low, 32));
+			__m256i product_high = _mm256_mul_epu32(keyed_high, _mm256_srli_epi64(keyed_high, 32));
+			low  = _mm256_add_epi64(low, _mm256_add_epi64(product_low, _mm256_shuffle_epi32(data_low, _MM_SHUFFLE(1, 0, 3, 2))));
+			high = _mm256_add_epi64(high, _mm256_add_epi64(product_high, _mm256_shuffle_epi32(data_high, _MM_SHUFFLE(1, 0, 3, 2))));
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(accumulators), low);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(accumulators + 4), high);
+	}
+
+	/// Scramble the accumulators at the end of a block using AVX2.
+	ESTD_TARGET("avx2") inline void scramble_avx2(std::uint64_t * accumulators, std::uint8_t const * secret) {
+		__m256i const prime = _mm256_set1_epi32(int(prime32_1));
+		for (std::size_t i = 0; i < 2; ++i) {
+			__m256i value = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(accumulators + 4 * i));
+			value = _mm256_xor_si256(value, _mm256_srli_epi64(value, 47));
+			value = _mm256_xor_si256(value, _mm256_loadu_si256(reinterpret_cast<__m256i const *>(secret + 32 * i)));
+
+			// 64 bit multiplication by a 32 bit constant, from two 32x32 bit multiplications.
+			__m256i product_low  = _mm256_mul_epu32(value, prime);
+			__m256i product_high = _mm256_mul_epu32(_mm256_srli_epi64(value, 32), prime);
+			value = _mm256_add_epi64(product_low, _mm256_slli_epi64(product_high, 32));
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(accumulators + 4 * i), value);
+		}
+	}
+#endif
+
+	/// The accumulate and scramble functions for the long input loop.
+	struct long_kernel {
+		void (*accumulate)(std::uint64_t * accumulators, std::uint8_t const * input, std::uint8_t const * secret, std::size_t stripes);
+		void (*scramble)(std::uint64_t * accumulators, std::uint8_t const * secret);
+	};
+
+	/// Select the fastest long input kernel supported by the CPU.
+	inline long_kernel select_long_kernel() noexcept {
+#ifdef ESTD_HAVE_X86_DISPATCH
+		if (cpu_has_avx2()) return {accumulate_avx2, scramble_avx2};
+#endif
+		return {accumulate_scalar, scramble_scalar};
+	}
+
+	/// Initialize the accumulators for long inputs.
+	inline void init_accumulators(std::uint64_t (&accumulators)[8]) {
+		accumulators[0] = prime32_3;
+		accumulators[1] = prime64_1;
+		accumulators[2] = prime64_2;
+		accumulators[3] = prime64_3;
+		accumulators[4] = prime64_4;
+		accumulators[5] = prime32_2;
+		accumulators[6] = prime64_5;
+		accumulators[7] = prime32_1;
+	}
+
+	/// Derive the secret for long inputs from a seed.
+	inline void init_secret(std::uint8_t (&secret)[secret_size], std::uint64_t seed) {
+		for (std::size_t i = 0; i < secret_size; i += 16) {
+			write64(secret + i,     read64(default_secret + i)     + seed);
+			write64(secret + i + 8, read64(default_secret + i + 8) - seed);
+		}
+	}
+
+	/// Merge the accumulators into the final hash.
+	inline std::uint64_t merge_accumulators(std::uint64_t const (&accumulators)[8], std::uint8_t const * secret, std::uint64_t size) {
+		std::uint64_t result = size * prime64_1;
+		for (std::size_t i = 0; i < 4; ++i) {
+			result += mul128_fold64(accumulators[2 * i] ^ read64(secret + 11 + 16 * i), accumulators[2 * i + 1] ^ read64(secret + 11 + 16 * i + 8));
+		}
+		return avalanche(result);
+	}
+
+	/// Mix the last stripe of a long input, which may overlap with stripes that were already consumed.
+	inline void accumulate_last_stripe(long_kernel kernel, std::uint64_t * accumulators, std::uint8_t const * stripe, std::uint8_t const * secret) {
+		kernel.accumulate(accumulators, stripe, secret + secret_size - stripe_size - 7, 1);
+	}
+
+	/// Hash an input larger than midsize_max.
+	inline std::uint64_t hash_long(std::uint8_t const * input, std::size_t size, std::uint8_t const * secret) {
+		long_kernel kernel = select_long_kernel();
+		std::uint64_t accumulators[8];
+		init_accumulators(accumulators);
+
+		constexpr std::size_t block_size = stripe_size * stripes_per_block;
+		std::size_t blocks = (size - 1) / block_size;
+		for (std::size_t i = 0; i < blocks; ++i) {
+			kernel.accumulate(accumulators, input + i * block_size, secret, stripes_per_block);
+			kernel.scramble(accumulators, secret + secret_size - stripe_size);
+		}
+
+		std::size_t stripes = ((size - 1) - block_size * blocks) / stripe_size;
+		kernel.accumulate(accumulators, input + blocks * block_size, secret, stripes);
+		accumulate_last_stripe(kernel, accumulators, input + size - stripe_size, secret);
+		return merge_accumulators(accumulators, secret, size);
+	}
+
+	/// Consume whole stripes, scrambling the accumulators at the end of each block.
+	/**
+	 * \return A pointer past the consumed input.
+	 */
+	inline std::uint8_t const * consume_stripes(
+		long_kernel kernel,
+		std::uint64_t * accumulators,
+		std::size_t & stripes_so_far,
+		std::uint8_t const * input,
+		std::size_t stripes,
+		std::uint8_t const * secret
+	) {
+		std::uint8_t const * block_secret = secret + stripes_so_far * secret_consume_rate;
+		if (stripes >= stripes_per_block - stripes_so_far) {
+			std::size_t count = stripes_per_block - stripes_so_far;
+			do {
+				kernel.accumulate(accumulators, input, block_secret, count);
+				kernel.scramble(accumulators, secret + secret_size - stripe_size);
+				input   += count * stripe_size;
+				stripes -= count;
+				count        = stripes_per_block;
+				block_secret = secret;
+			} while (stripes >= stripes_per_block);
+			stripes_so_far = 0;
+		}
+		if (stripes > 0) {
+			kernel.accumulate(accumulators, input, block_secret, stripes);
+			input += stripes * stripe_size;
+			stripes_so_far += stripes;
+		}
+		return input;
+	}
+}
+
+/// Compute the 64 bit XXH3 hash of a range of bytes.
+/**
+ * Large inputs are hashed with AVX2 if the CPU supports it.
+ */
+inline std::uint64_t hash(byte_view data, std::uint64_t seed = 0) {
+	std::uint8_t const * input = data.data();
+	std::size_t size = data.size();
+	if (size <= 16)  return detail::hash::hash_0to16(input, size, detail::hash::default_secret, seed);
+	if (size <= 128) return detail::hash::hash_17to128(input, size, detail::hash::default_secret, seed);
+	if (size <= detail::hash::midsize_max) return detail::hash::hash_129to240(input, size, detail::hash::default_secret, seed);
+	if (seed == 0) return detail::hash::hash_long(input, size, detail::hash::default_secret);
+
+	std::uint8_t secret[detail::hash::secret_size];
+	detail::hash::init_secret(secret, seed);
+	return detail::hash::hash_long(input, size, secret);
+}
+
+/// Incremental 64 bit hasher.
+/**
+ * The hasher implements streaming XXH3, so the digest of data fed in any number of chunks
+ * equals the XXH3 hash of the concatenated data with the same seed.
+ */
+class hasher {
+private:
+	std::uint64_t accumulators_[8];
+	std::uint8_t secret_[detail::hash::secret_size];
+	std::uint8_t buffer_[4 * detail::hash::stripe_size];
+	std::uint64_t seed_;
+	std::uint64_t total_size_;
+	std::size_t buffer_size_;
+	std::size_t stripes_so_far_;
+
+public:
+	/// Create a hasher with a seed.
+	explicit hasher(std::uint64_t seed = 0) {
+		reset(seed);
+	}
+
+	/// Discard all input and start over with a new seed.
+	void reset(std::uint64_t seed = 0) {
+		detail::hash::init_accumulators(accumulators_);
+		detail::hash::init_secret(secret_, seed);
+		seed_           = seed;
+		total_size_     = 0;
+		buffer_size_    = 0;
+		stripes_so_far_ = 0;
+	}
+
+	/// Add bytes to the hash.
+	hasher & update(byte_view data) {
+		constexpr std::size_t buffer_stripes = sizeof(buffer_) / detail::hash::stripe_size;
+		std::uint8_t const * input = data.data();
+		std::size_t size = data.size();
+		total_size_ += size;
+
+		// Keep the input buffered until there is more than a full buffer,
+		// so that the last stripe is always available for digest().
+		if (size <= sizeof(buffer_) && buffer_size_ + size <= sizeof(buffer_)) {
+			if (size > 0) std::memcpy(buffer_ + buffer_size_, input, size);
+			buffer_size_ += size;
+			return *this;
+		}
+
+		detail::hash::long_kernel kernel = detail::hash::select_long_kernel();
+		if (buffer_size_ > 0) {
+			std::size_t count = sizeof(buffer_) - buffer_size_;
+			std::memcpy(buffer_ + buffer_size_, input, count);
+			input += count;
+			size  -= count;
+			detail::hash::consume_stripes(kernel, accumulators_, stripes_so_far_, buffer_, buffer_stripes, secret_);
+			buffer_size_ = 0;
+		}
+
+		if (size > sizeof(buffer_)) {
+			std::uint8_t const * end = input + size;
+			input = detail::hash::consume_stripes(kernel, accumulators_, stripes_so_far_, input, (size - 1) / detail::hash::stripe_size, secret_);
+			size  = end - input;
+			// Remember the last consumed stripe, in case digest() needs it to complete the final stripe.
+			std::memcpy(buffer_ + sizeof(buffer_) - detail::hash::stripe_size, input - detail::hash::stripe_size, detail::hash::stripe_size);
+		}
+
+		std::memcpy(buffer_, input, size);
+		buffer_size_ = size;
+		return *this;
+	}
+
+	/// Add the object representation of the elements of a view to the hash.
+	template<typename T, typename = std::enable_if_t<is_byte_hashable<std::remove_const_t<T>>>>
+	hasher & update(view<T> data) {
+		return update(byte_view{reinterpret_cast<std::uint8_t const *>(data.data()), data.byte_size()});
+	}
+
+	/// Get the hash of all data added so far.
+	/**
+	 * The hasher is not modified, so more data can be added afterwards.
+	 */
+	std::uint64_t digest() const {
+		if (total_size_ <= detail::hash::midsize_max) return hash(byte_view{buffer_, std::size_t(total_size_)}, seed_);
+
+		detail::hash::long_kernel kernel = detail::hash::select_long_kernel();
+		std::uint64_t accumulators[8];
+		std::copy_n(accumulators_, 8, accumulators);
+
+		std::uint8_t last_stripe[detail::hash::stripe_size];
+		std::uint8_t const * last_stripe_data;
+		if (buffer_size_ >= detail::hash::stripe_size) {
+			std::size_t stripes_so_far = stripes_so_far_;
+			detail::hash::consume_stripes(kernel, accumulators, stripes_so_far, buffer_, (buffer_size_ - 1) / detail::hash::stripe_size, secret_);
+			last_stripe_data = buffer_ + buffer_size_ - detail::hash::stripe_size;
+		} else {
+			// Complete the last stripe with the end of the previously consumed input.
+			std::size_t catch_up = detail::hash::stripe_size - buffer_size_;
+			std::memcpy(last_stripe, buffer_ + sizeof(buffer_) - catch_up, catch_up);
+			std::memcpy(last_stripe + catch_up, buffer_, buffer_size_);
+			last_stripe_data = last_stripe;
+		}
+		detail::hash::accumulate_last_stripe(kernel, accumulators, last_stripe_data, secret_);
+		return detail::hash::merge_accumulators(accumulators, secret_, total_size_);
+	}
+};
+
+/// Compute the 64 bit hash of the object representation of the elements of a view.
+template<typename T, typename = std::enable_if_t<is_byte_hashable<std::remove_const_t<T>>>>
+std::uint64_t hash(view<T> data, std::uint64_t seed = 0) {
+	return hash(byte_view{reinterpret_cast<std::uint8_t const *>(data.data()), data.byte_size()}, seed);
+}
+
+/// Compute the 64 bit hash of the object representation of the elements of a heap array.
+template<typename T, typename Allocator, typename = std::enable_if_t<is_byte_hashable<T>>>
+std::uint64_t hash(heap_array<T, Allocator> const & data, std::uint64_t seed = 0) {
+	return hash(view<T const>{data.data(), data.size()}, seed);
+}
+
+namespace detail::hash {
+	/// Base for std::hash specializations of containers of byte hashable types.
+	template<typename Container, bool Enabled>
+	struct std_hash_base {
+		std::size_t operator() (Container const & data) const noexcept {
+			return std::size_t(estd::hash(data));
+		}
+	};
+
+	/// Disabled std::hash specialization for containers of types that are not byte hashable.
+	/**
+	 * Like the disabled specializations of the standard library,
+	 * this is not default constructible, copyable or movable.
+	 */
+	template<typename Container>
+	struct std_hash_base<Container, false> {
+		std_hash_base() = delete;
+		std_hash_base(std_hash_base const &) = delete;
+		std_hash_base & operator=(std_hash_base const &) = delete;
+	};
+}
+
+}
+
+namespace std {
+
+/// Hash a view by the contents of the elements.
+/**
+ * Two views with equal elements have equal hashes, regardless of where the elements are stored.
+ * The specialization is disabled for elements that are not byte hashable.
+ */
+template<typename T>
+struct hash<estd::view<T>> : estd::detail::hash::std_hash_base<estd::view<T>, estd::is_byte_hashable<std::remove_const_t<T>>> {};
+
+/// Hash a heap array by the contents of the elements.
+/**
+ * The specialization is disabled for elements that are not byte hashable.
+ */
+template<typename T, typename Allocator>
+struct hash<estd::heap_array<T, Allocator>> : estd::detail::hash::std_hash_base<estd::heap_array<T, Allocator>, estd::is_byte_hashable<T>> {};
+
+}
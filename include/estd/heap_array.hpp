@@ -28,3 +28,17 @@
 
 #pragma once
 #include "heap_array/heap_array.hpp"
+#include "heap_array/allocator.hpp"
+#include "heap_array/bit_heap_array.hpp"
+#include "heap_array/gather.hpp"
+#include "heap_array/parallel.hpp"
+#include "heap_array/pool.hpp"
+#include "heap_array/shared_heap_array.hpp"
+#include "heap_array/small_heap_array.hpp"
+#include "heap_array/spsc_ring.hpp"
+
+#if defined(__has_include)
+#  if __has_include(<sys/mman.h>)
+#    include "heap_array/mmap_allocator.hpp"
+#  endif
+#endif
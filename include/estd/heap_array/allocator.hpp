@@ -0,0 +1,209 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace estd {
+
+namespace detail {
+	/// Allocate raw storage for a number of elements of type T, without constructing them.
+	/**
+	 * \throws std::bad_array_new_length if the size in bytes overflows.
+	 * \throws std::bad_alloc if the allocation fails.
+	 */
+	template<typename T, std::size_t Alignment = alignof(T)>
+	T * allocate_aligned(std::size_t size) {
+		if (size > std::size_t(-1) / sizeof(T)) throw std::bad_array_new_length();
+		if constexpr (Alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			return static_cast<T *>(::operator new(size * sizeof(T), std::align_val_t{Alignment}));
+		} else {
+			return static_cast<T *>(::operator new(size * sizeof(T)));
+		}
+	}
+
+	/// Deallocate raw storage allocated with allocate_aligned().
+	template<std::size_t Alignment, typename T>
+	void deallocate_aligned(T * data) noexcept {
+		if constexpr (Alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			::operator delete(data, std::align_val_t{Alignment});
+		} else {
+			::operator delete(data);
+		}
+	}
+
+	/// Tell the compiler that a pointer is aligned to a given alignment.
+	template<std::size_t Alignment, typename T>
+	constexpr T * assume_aligned(T * pointer) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		return static_cast<T *>(__builtin_assume_aligned(pointer, Alignment));
+#else
+		return pointer;
+#endif
+	}
+
+	/// Get the alignment guaranteed by an allocator.
+	/**
+	 * Allocators can advertise a larger alignment than the natural alignment of their value type
+	 * with a static `alignment` member.
+	 */
+	template<typename Allocator, typename = void>
+	struct allocator_alignment : std::integral_constant<std::size_t, alignof(typename std::allocator_traits<Allocator>::value_type)> {};
+
+	template<typename Allocator>
+	struct allocator_alignment<Allocator, std::void_t<decltype(Allocator::alignment)>> : std::integral_constant<std::size_t, Allocator::alignment> {};
+
+	/// Check if an allocator can resize allocations with a reallocate(data, old_size, new_size) member.
+	template<typename Allocator, typename = void>
+	struct has_reallocate : std::false_type {};
+
+	template<typename Allocator>
+	struct has_reallocate<Allocator, std::void_t<decltype(std::declval<Allocator &>().reallocate(
+		std::declval<typename std::allocator_traits<Allocator>::pointer>(),
+		std::size_t(),
+		std::size_t()
+	))>> : std::true_type {};
+}
+
+/// Stateless allocator that aligns all allocations to a specific alignment.
+/**
+ * The alignment must be a power of two and at least the natural alignment of T.
+ */
+template<typename T, std::size_t Alignment>
+class aligned_allocator {
+	static_assert((Alignment & (Alignment - 1)) == 0, "alignment must be a power of two");
+	static_assert(Alignment >= alignof(T), "alignment must be at least the natural alignment of T");
+
+public:
+	using value_type      = T;
+	using size_type       = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using is_always_equal = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+
+	/// The alignment of all allocations in bytes.
+	static constexpr std::size_t alignment = Alignment;
+
+	template<typename U>
+	struct rebind {
+		using other = aligned_allocator<U, (Alignment > alignof(U) ? Alignment : alignof(U))>;
+	};
+
+	constexpr aligned_allocator() noexcept = default;
+
+	template<typename U, std::size_t OtherAlignment>
+	constexpr aligned_allocator(aligned_allocator<U, OtherAlignment> const &) noexcept {}
+
+	/// Allocate uninitialized storage for a number of elements.
+	T * allocate(std::size_t size) {
+		return detail::allocate_aligned<T, Alignment>(size);
+	}
+
+	/// Deallocate storage allocated by allocate().
+	void deallocate(T * data, std::size_t) noexcept {
+		detail::deallocate_aligned<Alignment>(data);
+	}
+
+	template<typename U, std::size_t OtherAlignment>
+	constexpr bool operator==(aligned_allocator<U, OtherAlignment> const &) const noexcept { return true; }
+
+	template<typename U, std::size_t OtherAlignment>
+	constexpr bool operator!=(aligned_allocator<U, OtherAlignment> const &) const noexcept { return false; }
+};
+
+/// Stateless allocator using std::malloc() and std::free().
+/**
+ * This allocator supports resizing allocations in place with std::realloc().
+ * heap_array uses that to grow and shrink arrays of trivially copyable types without copying when possible.
+ */
+template<typename T>
+class malloc_allocator {
+	static_assert(alignof(T) <= alignof(std::max_align_t), "malloc_allocator does not support over-aligned types");
+
+public:
+	using value_type      = T;
+	using size_type       = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using is_always_equal = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+
+	template<typename U>
+	struct rebind {
+		using other = malloc_allocator<U>;
+	};
+
+	constexpr malloc_allocator() noexcept = default;
+
+	template<typename U>
+	constexpr malloc_allocator(malloc_allocator<U> const &) noexcept {}
+
+	/// Allocate uninitialized storage for a number of elements.
+	/**
+	 * \throws std::bad_array_new_length if the size in bytes overflows.
+	 * \throws std::bad_alloc if the allocation fails.
+	 */
+	T * allocate(std::size_t size) {
+		if (size > std::size_t(-1) / sizeof(T)) throw std::bad_array_new_length();
+		void * data = std::malloc(size * sizeof(T));
+		if (!data) throw std::bad_alloc();
+		return static_cast<T *>(data);
+	}
+
+	/// Resize an allocation, possibly in place.
+	/**
+	 * The contents of the old allocation are copied bytewise if the allocation is moved,
+	 * so this may only be used for trivially copyable types.
+	 *
+	 * \throws std::bad_array_new_length if the size in bytes overflows.
+	 * \throws std::bad_alloc if the allocation fails, in which case the old allocation is left untouched.
+	 */
+	T * reallocate(T * data, std::size_t, std::size_t new_size) {
+		if (new_size > std::size_t(-1) / sizeof(T)) throw std::bad_array_new_length();
+		void * new_data = std::realloc(data, new_size * sizeof(T));
+		if (!new_data) throw std::bad_alloc();
+		return static_cast<T *>(new_data);
+	}
+
+	/// Deallocate storage allocated by allocate() or reallocate().
+	void deallocate(T * data, std::size_t) noexcept {
+		std::free(data);
+	}
+
+	template<typename U>
+	constexpr bool operator==(malloc_allocator<U> const &) const noexcept { return true; }
+
+	template<typename U>
+	constexpr bool operator!=(malloc_allocator<U> const &) const noexcept { return false; }
+};
+
+}
@@ -0,0 +1,203 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "./heap_array.hpp"
+#include "../view/bit_view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+
+namespace estd {
+
+/// An owning, fixed-size sequence of bits packed in 64 bit words.
+/**
+ * This uses one eighth of the memory of a heap_array<bool>,
+ * and masks can be counted, searched and combined a whole word (or vector register) at a time.
+ *
+ * The bits are stored as in bit_view, see basic_bit_view for the layout.
+ * Unused bits in the last word are always zero.
+ *
+ * Like heap_array, a bit_heap_array can be moved but not copied.
+ */
+class bit_heap_array {
+	/// The words holding the bits.
+	heap_array<std::uint64_t> words_;
+
+	/// The number of bits.
+	std::size_t size_;
+
+	/// Get a mutable view on the bits.
+	mut_bit_view bits() { return {words_.data(), size_}; }
+
+	/// Get a read-only view on the bits.
+	bit_view bits() const { return {words_.data(), size_}; }
+
+public:
+	using value_type     = bool;
+	using reference      = bit_reference;
+	using iterator       = mut_bit_view::iterator;
+	using const_iterator = bit_view::iterator;
+	using size_type      = std::size_t;
+
+	/// Create an empty bit array.
+	bit_heap_array() : words_{}, size_{0} {}
+
+	/// Create a bit array from a list of bit values.
+	bit_heap_array(std::initializer_list<bool> values) : bit_heap_array(allocate(values.size())) {
+		std::size_t index = 0;
+		for (bool value : values) set(index++, value);
+	}
+
+	bit_heap_array(bit_heap_array && other) noexcept :
+		words_{std::move(other.words_)},
+		size_{std::exchange(other.size_, 0)} {}
+
+	bit_heap_array & operator=(bit_heap_array && other) noexcept {
+		words_ = std::move(other.words_);
+		size_  = std::exchange(other.size_, 0);
+		return *this;
+	}
+
+	/// Create a bit array with a given size, with all bits set to the same value.
+	static bit_heap_array allocate(std::size_t size, bool value = false) {
+		bit_heap_array result;
+		result.words_ = heap_array<std::uint64_t>::allocate(detail::bits::word_count(size));
+		result.size_  = size;
+		if (value) result.fill(true);
+		return result;
+	}
+
+	/// Resize the bit array, setting new bits to a value.
+	/**
+	 * Views on the bits are invalidated.
+	 */
+	void resize(std::size_t new_size, bool value = false) {
+		std::size_t old_size = size_;
+		if (new_size < old_size) {
+			// Clear the bits past the new end to keep the unused bits of the last word zero.
+			bits().fill(new_size, old_size, false);
+		}
+		words_.resize(detail::bits::word_count(new_size));
+		size_ = new_size;
+		if (new_size > old_size && value) bits().fill(old_size, new_size, true);
+	}
+
+	/// Allow implicit conversion to a read-only bit view.
+	operator bit_view() const { return bits(); }
+
+	/// Allow implicit conversion to a mutable bit view.
+	operator mut_bit_view() { return bits(); }
+
+	/// Get the number of bits.
+	std::size_t size() const noexcept { return size_; }
+
+	/// Check if the array has no bits.
+	bool empty() const noexcept { return size_ == 0; }
+
+	/// Get the number of words holding the bits.
+	std::size_t word_count() const noexcept { return words_.size(); }
+
+	/// Get a pointer to the first word.
+	std::uint64_t       * data()       noexcept { return words_.data(); }
+	std::uint64_t const * data() const noexcept { return words_.data(); }
+
+	/// Get a view on the words holding the bits, for word-level iteration.
+	view<std::uint64_t const> words() const { return words_; }
+
+	/// Get a bit by index, without bounds checking.
+	bit_reference operator[](std::size_t index)       { return bits()[index]; }
+	bool          operator[](std::size_t index) const { return bits()[index]; }
+
+	/// Get a bit by index.
+	/**
+	 * \throws std::out_of_range if the index is out of bounds.
+	 */
+	bool test(std::size_t index) const { return bits().test(index); }
+
+	/// Set a bit by index, without bounds checking.
+	void set(std::size_t index, bool value = true) { bits().set(index, value); }
+
+	/// Clear a bit by index, without bounds checking.
+	void reset(std::size_t index) { bits().reset(index); }
+
+	/// Flip a bit by index, without bounds checking.
+	void flip(std::size_t index) { bits().flip(index); }
+
+	/// Set all bits to a value.
+	void fill(bool value) { bits().fill(value); }
+
+	/// Count the number of set bits.
+	std::size_t count() const { return bits().count(); }
+
+	/// Find the index of the first set bit, or npos if no bit is set.
+	std::size_t find_first() const { return bits().find_first(); }
+
+	/// Find the index of the first set bit at or after a position, or npos if there is none.
+	std::size_t find_next(std::size_t position) const { return bits().find_next(position); }
+
+	/// Keep only the bits that are also set in a mask of the same size.
+	/**
+	 * \throws std::length_error if the sizes differ.
+	 */
+	bit_heap_array & operator&=(bit_view other) { bits() &= other; return *this; }
+
+	/// Set the bits that are set in a mask of the same size.
+	/**
+	 * \throws std::length_error if the sizes differ.
+	 */
+	bit_heap_array & operator|=(bit_view other) { bits() |= other; return *this; }
+
+	/// Flip the bits that are set in a mask of the same size.
+	/**
+	 * \throws std::length_error if the sizes differ.
+	 */
+	bit_heap_array & operator^=(bit_view other) { bits() ^= other; return *this; }
+
+	/// Clear the bits that are set in a mask of the same size.
+	/**
+	 * \throws std::length_error if the sizes differ.
+	 */
+	bit_heap_array & and_not(bit_view other) { bits().and_not(other); return *this; }
+
+	/// Compare two bit arrays for equality.
+	bool operator==(bit_heap_array const & other) const { return bits() == other.bits(); }
+
+	/// Compare two bit arrays for inequality.
+	bool operator!=(bit_heap_array const & other) const { return !(*this == other); }
+
+	iterator       begin()       { return bits().begin(); }
+	iterator       end()         { return bits().end(); }
+	const_iterator begin() const { return bits().begin(); }
+	const_iterator end()   const { return bits().end(); }
+};
+
+}
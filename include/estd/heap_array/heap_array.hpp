@@ -28,6 +28,8 @@
 
 #pragma once
 #include "../view/view.hpp"
+#include "../view/aligned_view.hpp"
+#include "./allocator.hpp"
 
 #include <algorithm>
 #include <cstdint>
@@ -36,13 +38,38 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 
+#if defined(__has_include)
+#  if __has_include(<memory_resource>)
+#    include <memory_resource>
+#    define ESTD_HAVE_MEMORY_RESOURCE
+#  endif
+#endif
+
 namespace estd {
 
 /// A simple owning array type allocated on the heap.
-template<typename T>
+/**
+ * The storage is obtained from \p Allocator, which defaults to std::allocator<T>.
+ * The allocator is stored in the heap array and moved along with it,
+ * so moving a heap array never copies the elements.
+ *
+ * The data of the array is aligned to at least the natural alignment of \p T.
+ * Allocators can guarantee a larger alignment with a static `alignment` member,
+ * see aligned_allocator and aligned_heap_array.
+ * The array converts to an aligned_view that carries this alignment in its type.
+ *
+ * Elements are constructed with placement new, not with the construct() member of the allocator.
+ */
+template<typename T, typename Allocator = std::allocator<T>>
 class heap_array {
+	using allocator_traits = std::allocator_traits<Allocator>;
+
+	static_assert(std::is_same_v<typename allocator_traits::value_type, T>, "value_type of the allocator must be T");
+	static_assert(std::is_same_v<typename allocator_traits::pointer, T *>, "the allocator must use raw pointers");
+
 public:
 	using value_type       = T;
 	using reference        = T &;
@@ -51,50 +78,251 @@ public:
 	using const_iterator   = T const *;
 	using difference_type  = std::ptrdiff_t;
 	using size_type        = std::size_t;
+	using allocator_type   = Allocator;
+
+	/// The guaranteed alignment of data() in bytes.
+	static constexpr std::size_t alignment = detail::allocator_alignment<Allocator>::value;
 
 private:
-	/// The data.
-	std::unique_ptr<T[]> data_;
+	/// The allocator, data and size.
+	/**
+	 * Deriving from the allocator makes stateless allocators take no space.
+	 */
+	struct storage : Allocator {
+		/// The data.
+		T * data;
+
+		/// The size of the array in elements.
+		std::size_t size;
 
-	/// The size of the array in elements.
-	std::size_t size_;
+		constexpr storage(Allocator const & allocator, T * data, std::size_t size) : Allocator(allocator), data{data}, size{size} {}
+	} storage_;
+
+	/// Get the allocator.
+	Allocator & allocator() noexcept { return storage_; }
+
+	/// Allocate storage and construct the elements with a function.
+	/**
+	 * The function is called with a pointer to the raw storage and the number of elements.
+	 * If the function throws, the storage is released again.
+	 * The function itself is responsible for cleaning up partially constructed elements,
+	 * like the std::uninitialized_* algorithms do.
+	 */
+	template<typename F>
+	static heap_array construct_with(std::size_t size, Allocator const & allocator, F && construct) {
+		heap_array result(allocator);
+		if (!size) return result;
+		T * data = allocator_traits::allocate(result.allocator(), size);
+		try {
+			construct(data, size);
+		} catch (...) {
+			allocator_traits::deallocate(result.allocator(), data, size);
+			throw;
+		}
+		result.storage_.data = data;
+		result.storage_.size = size;
+		return result;
+	}
+
+	/// Destroy all elements and release the storage.
+	void release() noexcept {
+		if (!storage_.data) return;
+		if constexpr (!std::is_trivially_destructible_v<T>) std::destroy_n(storage_.data, storage_.size);
+		allocator_traits::deallocate(allocator(), storage_.data, storage_.size);
+		storage_.data = nullptr;
+		storage_.size = 0;
+	}
+
+	/// Resize the storage and construct new elements at the end with a function.
+	/**
+	 * Trivially copyable elements are resized in place with the reallocate() member of the allocator, if it has one.
+	 * Otherwise, new storage is allocated and the elements are moved over.
+	 * If moving can throw, elements are copied instead (if possible) so that the array is left untouched on errors.
+	 */
+	template<typename F>
+	void resize_with(std::size_t new_size, F && construct_tail) {
+		std::size_t old_size = size();
+		if (new_size == old_size) return;
+		if (new_size == 0) return release();
+
+		if constexpr (std::is_trivially_copyable_v<T> && detail::has_reallocate<Allocator>::value) {
+			if (storage_.data) {
+				storage_.data = allocator().reallocate(storage_.data, old_size, new_size);
+			} else {
+				storage_.data = allocator_traits::allocate(allocator(), new_size);
+			}
+			storage_.size = new_size;
+			if (new_size > old_size) construct_tail(storage_.data + old_size, new_size - old_size);
+		} else {
+			std::size_t keep = std::min(old_size, new_size);
+			T * data = allocator_traits::allocate(allocator(), new_size);
+			try {
+				if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+					std::uninitialized_move_n(storage_.data, keep, data);
+				} else {
+					std::uninitialized_copy_n(storage_.data, keep, data);
+				}
+				try {
+					if (new_size > old_size) construct_tail(data + old_size, new_size - old_size);
+				} catch (...) {
+					std::destroy_n(data, keep);
+					throw;
+				}
+			} catch (...) {
+				allocator_traits::deallocate(allocator(), data, new_size);
+				throw;
+			}
+			release();
+			storage_.data = data;
+			storage_.size = new_size;
+		}
+	}
+
+	/// Release our own storage and take over the storage of another array.
+	void steal(heap_array & other) noexcept {
+		release();
+		storage_.data = std::exchange(other.storage_.data, nullptr);
+		storage_.size = std::exchange(other.storage_.size, 0);
+	}
 
 public:
 	/// Create an empty heap array (does not perform any heap allocation).
-	constexpr heap_array() : data_{nullptr}, size_{0} {}
+	constexpr heap_array() noexcept(noexcept(Allocator())) : storage_{Allocator(), nullptr, 0} {}
 
-	/// Create a heap array from a raw std::unique_ptr<T[]> and a size.
-	constexpr heap_array(std::unique_ptr<T[]> data, std::size_t size) : data_{std::move(data)}, size_{size} {}
+	/// Create an empty heap array that will use the given allocator (does not perform any heap allocation).
+	explicit heap_array(Allocator const & allocator) noexcept : storage_{allocator, nullptr, 0} {}
 
 	/// Create a heap array from list of values.
 	/**
 	 * Note that the values will be copied into the array,
 	 * since initializer lists only give const access to their contents.
 	 */
-	constexpr heap_array(std::initializer_list<T> data) : heap_array(allocate(data.size())) {
-		std::size_t i = 0;
-		for (auto & entry : data) {
-			data_[i++] = std::move(entry);
+	heap_array(std::initializer_list<T> data, Allocator const & allocator = Allocator()) :
+		heap_array(construct_with(data.size(), allocator, [&data] (T * storage, std::size_t) {
+			std::uninitialized_copy(data.begin(), data.end(), storage);
+		})) {}
+
+	/// Move construct a heap array, leaving the other array empty.
+	/**
+	 * The allocator is moved along with the data.
+	 */
+	heap_array(heap_array && other) noexcept :
+		storage_{std::move(other.allocator()), std::exchange(other.storage_.data, nullptr), std::exchange(other.storage_.size, 0)} {}
+
+	/// Move assign a heap array, leaving the other array empty.
+	/**
+	 * If the allocator does not propagate on move assignment and the allocators compare unequal,
+	 * the elements are moved one by one into storage obtained from our own allocator.
+	 * Otherwise, the storage is taken over directly.
+	 */
+	heap_array & operator=(heap_array && other) noexcept(
+		allocator_traits::propagate_on_container_move_assignment::value || allocator_traits::is_always_equal::value
+	) {
+		if (this == &other) return *this;
+		if constexpr (allocator_traits::propagate_on_container_move_assignment::value) {
+			release();
+			allocator() = std::move(other.allocator());
+			steal(other);
+		} else if constexpr (allocator_traits::is_always_equal::value) {
+			steal(other);
+		} else if (allocator() == other.allocator()) {
+			steal(other);
+		} else {
+			heap_array moved = construct_with(other.size(), allocator(), [&other] (T * storage, std::size_t size) {
+				std::uninitialized_move_n(other.data(), size, storage);
+			});
+			steal(moved);
+			other.release();
 		}
+		return *this;
+	}
+
+	heap_array(heap_array const &) = delete;
+	heap_array & operator=(heap_array const &) = delete;
+
+	/// Destroy the elements and free the storage.
+	/**
+	 * The elements are only destroyed one by one if T is not trivially destructible.
+	 */
+	~heap_array() {
+		release();
 	}
 
 	/// Create a value-initialized array with a given size.
-	static heap_array allocate(std::size_t size) {
-		if (!size) return heap_array{};
-		return {std::make_unique<T[]>(size), size};
+	static heap_array allocate(std::size_t size, Allocator const & allocator = Allocator()) {
+		return construct_with(size, allocator, [] (T * data, std::size_t size) {
+			std::uninitialized_value_construct_n(data, size);
+		});
+	}
+
+	/// Create a default-initialized array with a given size.
+	/**
+	 * If T is trivially default constructible, the elements are left uninitialized
+	 * and the memory is not touched at all.
+	 * Reading from the elements before writing to them is undefined behaviour in that case.
+	 *
+	 * Otherwise, the elements are default constructed.
+	 */
+	static heap_array uninitialized(std::size_t size, Allocator const & allocator = Allocator()) {
+		return construct_with(size, allocator, [] (T * data, std::size_t size) {
+			if constexpr (!std::is_trivially_default_constructible_v<T>) std::uninitialized_default_construct_n(data, size);
+		});
 	}
 
 	/// Create a default-initialized array with a given size.
-	static heap_array unitialized(std::size_t size) {
-		if (!size) return heap_array{};
-		// TODO: Should we do default initialization or really uninitialized?
-		return {std::unique_ptr<T[]>(new T[size]), size};
+	/**
+	 * Deprecated alias for uninitialized().
+	 */
+	[[deprecated("use uninitialized() instead")]]
+	static heap_array unitialized(std::size_t size, Allocator const & allocator = Allocator()) {
+		return uninitialized(size, allocator);
+	}
+
+	/// Resize the array, value-initializing new elements.
+	/**
+	 * If T is trivially copyable and the allocator supports it (see malloc_allocator),
+	 * the storage is resized in place when possible.
+	 * Otherwise the elements are moved into new storage.
+	 *
+	 * Pointers, references and views to the elements are invalidated.
+	 */
+	void resize(std::size_t new_size) {
+		resize_with(new_size, [] (T * data, std::size_t count) {
+			std::uninitialized_value_construct_n(data, count);
+		});
+	}
+
+	/// Resize the array, default-initializing new elements.
+	/**
+	 * This is the same as resize(), except that new elements are default-initialized.
+	 * For trivially default constructible types, this means the new elements are left uninitialized.
+	 */
+	void resize_uninitialized(std::size_t new_size) {
+		resize_with(new_size, [] (T * data, std::size_t count) {
+			if constexpr (!std::is_trivially_default_constructible_v<T>) std::uninitialized_default_construct_n(data, count);
+		});
+	}
+
+	/// Shrink the array to a smaller size, destroying the elements past the new size.
+	/**
+	 * Unlike resize(), this does not require T to be default constructible.
+	 *
+	 * \throws std::length_error if the new size is larger than the current size.
+	 */
+	void shrink_to(std::size_t new_size) {
+		if (new_size > size()) throw std::length_error("can not shrink heap array of size " + std::to_string(size()) + " to larger size " + std::to_string(new_size));
+		resize_with(new_size, [] (T *, std::size_t) {});
+	}
+
+	/// Get a copy of the allocator.
+	Allocator get_allocator() const noexcept {
+		return storage_;
 	}
 
 	/// Get a pointer to the first element.
-	constexpr T       * begin()        noexcept { return data_.get(); }
-	constexpr T const * begin()  const noexcept { return data_.get(); }
-	constexpr T const * cbegin() const noexcept { return data_.get(); }
+	constexpr T       * begin()        noexcept { return data(); }
+	constexpr T const * begin()  const noexcept { return data(); }
+	constexpr T const * cbegin() const noexcept { return data(); }
 
 	/// Get a pointer directly past the last element.
 	constexpr T       * end()        noexcept { return begin() + size(); }
@@ -102,17 +330,20 @@ public:
 	constexpr T const * cend() const noexcept { return begin() + size(); }
 
 	/// Get a pointer to the data.
-	constexpr T       * data()        noexcept { return data_.get(); }
-	constexpr T const * data()  const noexcept { return data_.get(); }
+	/**
+	 * The pointer is aligned to at least `alignment` bytes.
+	 */
+	constexpr T       * data()        noexcept { return detail::assume_aligned<alignment>(storage_.data); }
+	constexpr T const * data()  const noexcept { return detail::assume_aligned<alignment>(storage_.data); }
 
 	/// Get the number of elements in the array.
 	constexpr std::size_t size() const noexcept {
-		return size_;
+		return storage_.size;
 	}
 
 	/// Check if the array is empty (has size 0).
 	constexpr bool empty() const noexcept {
-		return size_ == 0;
+		return storage_.size == 0;
 	}
 
 	/// Get the total size of the array in bytes.
@@ -162,24 +393,86 @@ public:
 		return view<T const>{data(), size()};
 	}
 
+	/// Allow implicitly conversion to a non-owning view that carries the alignment of the data.
+	constexpr operator aligned_view<T, alignment>() noexcept {
+		return aligned_view<T, alignment>::assume_aligned(*this);
+	}
+
+	/// Allow implicitly conversion to a non-owning view that carries the alignment of the data.
+	constexpr operator aligned_view<T const, alignment>() const noexcept {
+		return aligned_view<T const, alignment>::assume_aligned(*this);
+	}
+
 	/// Compare two heap arrays for equality.
 	/**
 	 * Two heap arrays are equal if their ranges of elements are equal.
+	 *
+	 * Arrays of integers, enums and pointers are compared with memcmp.
 	 */
-	bool operator==(heap_array const & other) {
-		return size() == other.size() && std::equal(begin(), end(), other.begin());
+	bool operator==(heap_array const & other) const {
+		return view<T const>(*this) == view<T const>(other);
 	}
 
 	/// Compare two heap arrays for inequality.
 	/**
 	 * Two heap arrays are equal if their ranges of elements are equal.
 	 */
-	bool operator!=(heap_array const & other) {
+	bool operator!=(heap_array const & other) const {
 		return !(*this == other);
 	}
+
+	/// Compare two heap arrays lexicographically.
+	/**
+	 * \return A negative value if this array sorts before the other array, zero if they are equal, and a positive value otherwise.
+	 */
+	int compare(heap_array const & other) const {
+		return view<T const>(*this).compare(view<T const>(other));
+	}
+
+	/// Check if this array sorts lexicographically before another array.
+	bool operator<(heap_array const & other) const { return compare(other) < 0; }
+
+	/// Check if this array sorts lexicographically before or equal to another array.
+	bool operator<=(heap_array const & other) const { return compare(other) <= 0; }
+
+	/// Check if this array sorts lexicographically after another array.
+	bool operator>(heap_array const & other) const { return compare(other) > 0; }
+
+	/// Check if this array sorts lexicographically after or equal to another array.
+	bool operator>=(heap_array const & other) const { return compare(other) >= 0; }
 };
 
+/// Heap array with data aligned to a specific alignment.
+/**
+ * Useful for SIMD kernels: aligned_heap_array<float, 32> for AVX2, aligned_heap_array<float, 64> for AVX-512 or cache lines,
+ * or aligned_heap_array<T, 4096> for page aligned data.
+ */
+template<typename T, std::size_t Alignment>
+using aligned_heap_array = heap_array<T, aligned_allocator<T, Alignment>>;
+
+/// Heap array allocated with std::malloc(), which can be resized in place for trivially copyable types.
+template<typename T>
+using malloc_heap_array = heap_array<T, malloc_allocator<T>>;
+
 /// Typedef for heap arrays of bytes.
 using byte_heap_array = heap_array<std::uint8_t>;
 
+#ifdef ESTD_HAVE_MEMORY_RESOURCE
+namespace pmr {
+	/// Heap array using a std::pmr::memory_resource for allocations.
+	/**
+	 * The memory resource can be passed to the factory functions directly:
+	 * \code
+	 * std::pmr::monotonic_buffer_resource arena;
+	 * auto buffer = estd::pmr::byte_heap_array::uninitialized(1024, &arena);
+	 * \endcode
+	 */
+	template<typename T>
+	using heap_array = estd::heap_array<T, std::pmr::polymorphic_allocator<T>>;
+
+	/// Typedef for heap arrays of bytes using a std::pmr::memory_resource.
+	using byte_heap_array = heap_array<std::uint8_t>;
+}
+#endif
+
 }
@@ -0,0 +1,268 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include "./allocator.hpp"
+#include "./heap_array.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace estd {
+
+/// Policy for using huge pages in mmap_allocator.
+enum class huge_page_policy {
+	/// Use regular pages.
+	none,
+
+	/// Ask the kernel to back the mapping with transparent huge pages using madvise(MADV_HUGEPAGE).
+	transparent,
+
+	/// Map explicit 2 MiB huge pages with MAP_HUGETLB.
+	/**
+	 * Falls back to transparent huge pages if no 2 MiB huge pages are available.
+	 * Allocations are rounded up to a multiple of the huge page size.
+	 */
+	hugetlb,
+};
+
+namespace detail {
+	/// The base 2 logarithm of the size of an explicit huge page used by huge_page_policy::hugetlb.
+	constexpr int huge_page_shift = 21;
+
+	/// The size of an explicit huge page used by huge_page_policy::hugetlb.
+	/**
+	 * The page size is passed to mmap() explicitly, since the default huge page size of the system
+	 * can be different (for example 1 GiB, or 512 MiB on aarch64 with 64 KiB pages).
+	 */
+	constexpr std::size_t huge_page_size = std::size_t(1) << huge_page_shift;
+
+	/// Get the system page size.
+	inline std::size_t page_size() noexcept {
+		static std::size_t const size = ::sysconf(_SC_PAGESIZE);
+		return size;
+	}
+
+	/// Round a size up to a multiple of a power of two.
+	constexpr std::size_t round_up_pow2(std::size_t size, std::size_t multiple) noexcept {
+		return (size + multiple - 1) & ~(multiple - 1);
+	}
+}
+
+/// Allocator that uses anonymous memory mappings for large allocations.
+/**
+ * Allocations of at least `threshold` bytes are served by mmap(),
+ * optionally backed by huge pages to reduce TLB misses on large arrays.
+ * Smaller allocations are served by std::malloc(), since mapping them would waste memory.
+ *
+ * Whether an allocation is mapped depends only on its size and the settings of the allocator,
+ * so allocators only compare equal if they have the same settings.
+ *
+ * The allocator supports reallocate(), so heap_array can resize arrays of trivially copyable types without copying.
+ * On Linux, mapped allocations are resized with mremap().
+ */
+template<typename T>
+class mmap_allocator {
+	static_assert(alignof(T) <= alignof(std::max_align_t), "mmap_allocator does not support over-aligned types");
+
+	template<typename U> friend class mmap_allocator;
+
+public:
+	using value_type      = T;
+	using size_type       = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using is_always_equal = std::false_type;
+	using propagate_on_container_move_assignment = std::true_type;
+
+	/// The default threshold in bytes above which allocations are mapped.
+	static constexpr std::size_t default_threshold = std::size_t(32) * 1024 * 1024;
+
+	template<typename U>
+	struct rebind {
+		using other = mmap_allocator<U>;
+	};
+
+private:
+	/// The minimum size in bytes for an allocation to be mapped.
+	std::size_t threshold_;
+
+	/// The policy for using huge pages.
+	huge_page_policy huge_pages_;
+
+	/// Check if an allocation of a given size in bytes is mapped.
+	bool is_mapped(std::size_t bytes) const noexcept {
+		return bytes >= threshold_;
+	}
+
+	/// Get the length of the mapping for an allocation of a given size in bytes.
+	std::size_t mapping_length(std::size_t bytes) const noexcept {
+		if (huge_pages_ == huge_page_policy::hugetlb) return detail::round_up_pow2(bytes, detail::huge_page_size);
+		return detail::round_up_pow2(bytes, detail::page_size());
+	}
+
+	/// Get the size in bytes of a number of elements.
+	static std::size_t byte_size(std::size_t size) {
+		if (size > std::size_t(-1) / sizeof(T)) throw std::bad_array_new_length();
+		return size * sizeof(T);
+	}
+
+	/// Create a new anonymous mapping.
+	void * map(std::size_t length) const {
+		int const protection = PROT_READ | PROT_WRITE;
+		int const flags      = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+		// Without MAP_HUGE_SHIFT the page size can not be selected, so the mapping length may not be a multiple of it.
+		if (huge_pages_ == huge_page_policy::hugetlb) {
+			int const huge_page_flags = MAP_HUGETLB | (detail::huge_page_shift << MAP_HUGE_SHIFT);
+			void * data = ::mmap(nullptr, length, protection, flags | huge_page_flags, -1, 0);
+			if (data != MAP_FAILED) return data;
+		}
+#endif
+
+		void * data = ::mmap(nullptr, length, protection, flags, -1, 0);
+		if (data == MAP_FAILED) throw std::bad_alloc();
+		advise(data, length);
+		return data;
+	}
+
+	/// Ask for transparent huge pages if requested by the policy.
+	void advise(void * data, std::size_t length) const noexcept {
+#ifdef MADV_HUGEPAGE
+		if (huge_pages_ != huge_page_policy::none) ::madvise(data, length, MADV_HUGEPAGE);
+#else
+		(void) data;
+		(void) length;
+#endif
+	}
+
+public:
+	/// Create an allocator.
+	/**
+	 * \param threshold  The minimum size in bytes for an allocation to be mapped.
+	 * \param huge_pages The policy for using huge pages for mapped allocations.
+	 */
+	explicit mmap_allocator(std::size_t threshold = default_threshold, huge_page_policy huge_pages = huge_page_policy::transparent) noexcept :
+		threshold_{threshold},
+		huge_pages_{huge_pages} {}
+
+	template<typename U>
+	mmap_allocator(mmap_allocator<U> const & other) noexcept :
+		threshold_{other.threshold_},
+		huge_pages_{other.huge_pages_} {}
+
+	/// Get the minimum size in bytes for an allocation to be mapped.
+	std::size_t threshold() const noexcept {
+		return threshold_;
+	}
+
+	/// Get the policy for using huge pages.
+	huge_page_policy huge_pages() const noexcept {
+		return huge_pages_;
+	}
+
+	/// Allocate uninitialized storage for a number of elements.
+	/**
+	 * \throws std::bad_array_new_length if the size in bytes overflows.
+	 * \throws std::bad_alloc if the allocation fails.
+	 */
+	T * allocate(std::size_t size) {
+		std::size_t bytes = byte_size(size);
+		if (is_mapped(bytes)) return static_cast<T *>(map(mapping_length(bytes)));
+		void * data = std::malloc(bytes);
+		if (!data) throw std::bad_alloc();
+		return static_cast<T *>(data);
+	}
+
+	/// Resize an allocation, possibly in place.
+	/**
+	 * The contents of the old allocation are copied bytewise if the allocation is moved,
+	 * so this may only be used for trivially copyable types.
+	 *
+	 * \throws std::bad_array_new_length if the size in bytes overflows.
+	 * \throws std::bad_alloc if the allocation fails, in which case the old allocation is left untouched.
+	 */
+	T * reallocate(T * data, std::size_t old_size, std::size_t new_size) {
+		std::size_t old_bytes = byte_size(old_size);
+		std::size_t new_bytes = byte_size(new_size);
+
+		if (!is_mapped(old_bytes) && !is_mapped(new_bytes)) {
+			void * new_data = std::realloc(data, new_bytes);
+			if (!new_data) throw std::bad_alloc();
+			return static_cast<T *>(new_data);
+		}
+
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+		// Explicit huge page mappings can not be resized to arbitrary sizes, so only use mremap for regular mappings.
+		if (is_mapped(old_bytes) && is_mapped(new_bytes) && huge_pages_ != huge_page_policy::hugetlb) {
+			std::size_t new_length = mapping_length(new_bytes);
+			void * new_data = ::mremap(data, mapping_length(old_bytes), new_length, MREMAP_MAYMOVE);
+			if (new_data == MAP_FAILED) throw std::bad_alloc();
+			advise(new_data, new_length);
+			return static_cast<T *>(new_data);
+		}
+#endif
+
+		T * new_data = allocate(new_size);
+		std::memcpy(new_data, data, old_bytes < new_bytes ? old_bytes : new_bytes);
+		deallocate(data, old_size);
+		return new_data;
+	}
+
+	/// Deallocate storage allocated by allocate() or reallocate().
+	void deallocate(T * data, std::size_t size) noexcept {
+		std::size_t bytes = size * sizeof(T);
+		if (is_mapped(bytes)) {
+			::munmap(data, mapping_length(bytes));
+		} else {
+			std::free(data);
+		}
+	}
+
+	template<typename U>
+	bool operator==(mmap_allocator<U> const & other) const noexcept {
+		return threshold_ == other.threshold_ && huge_pages_ == other.huge_pages_;
+	}
+
+	template<typename U>
+	bool operator!=(mmap_allocator<U> const & other) const noexcept {
+		return !(*this == other);
+	}
+};
+
+/// Heap array using anonymous memory mappings for large allocations.
+template<typename T>
+using mmap_heap_array = heap_array<T, mmap_allocator<T>>;
+
+}
@@ -0,0 +1,138 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include "./heap_array.hpp"
+#include "../view/view.hpp"
+#include "../view/chunks.hpp"
+#include "../scope_guard/scope_guard.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace estd {
+
+/// The granularity in bytes of chunk boundaries for parallel first-touch initialization.
+/**
+ * This is the common page size, so that each page is first touched by a single thread.
+ */
+constexpr std::size_t first_touch_granularity = 4096;
+
+/// Executor for parallel initialization that runs each chunk on a new std::thread.
+/**
+ * An executor is called as `executor(chunk_count, task)`, and must call `task(i)` exactly once for each chunk index `i` in `[0, chunk_count)`.
+ * It may only return when all tasks have finished, also when it throws.
+ *
+ * With this executor, the operating system decides where the threads run.
+ * To make sure pages end up on the NUMA node that will process them,
+ * pass an executor that runs chunk `i` on the same worker thread that will later process chunk `i`.
+ *
+ * Using this executor requires linking with the system thread library.
+ */
+struct thread_per_chunk {
+	template<typename F>
+	void operator()(std::size_t chunks, F && task) const {
+		std::vector<std::thread> threads;
+		threads.reserve(chunks);
+
+		// Join the started threads even if starting another thread or task(0) throws.
+		scope_guard join_all{[&threads] () {
+			for (std::thread & thread : threads) thread.join();
+		}};
+
+		for (std::size_t i = 1; i < chunks; ++i) threads.emplace_back([&task, i] () { task(i); });
+		if (chunks > 0) task(0);
+	}
+};
+
+/// Get the chunk with a given index when splitting a view in a number of chunks for parallel processing.
+/**
+ * The chunks have approximately equal size.
+ * The boundaries between chunks are moved down to a multiple of first_touch_granularity in memory,
+ * so that each page (except for those containing an element straddling a page boundary) belongs to exactly one chunk.
+ * This is the same as `chunks(data, chunks, first_touch_granularity)[index]`.
+ * Note that the boundaries depend on the address of the data, not only on its size.
+ *
+ * allocate_parallel() and fill_parallel() initialize the elements of chunk `i` from task `i`.
+ * Later processing should use the same chunks on the same threads to access memory local to the thread.
+ */
+template<typename T>
+view<T> parallel_chunk(view<T> data, std::size_t chunks, std::size_t index) {
+	return estd::chunks(data, chunks, first_touch_granularity)[index];
+}
+
+/// Allocate a value-initialized heap array, initializing the elements in parallel.
+/**
+ * The elements of chunk `i` (as given by parallel_chunk()) are initialized by `task(i)` run from the executor.
+ * This way, the pages of each chunk are first touched (and physically allocated) by the thread processing that chunk,
+ * which places them on the NUMA node of that thread.
+ *
+ * Only trivial types are supported, since initializing them can not throw.
+ *
+ * \throws std::invalid_argument if chunks is zero.
+ */
+template<typename T, typename Allocator = std::allocator<T>, typename Executor = thread_per_chunk>
+heap_array<T, Allocator> allocate_parallel(std::size_t size, std::size_t chunks, Executor && executor = {}, Allocator const & allocator = Allocator()) {
+	static_assert(std::is_trivial_v<T>, "parallel initialization is only supported for trivial types");
+	if (chunks == 0) throw std::invalid_argument("parallel initialization needs at least one chunk");
+	heap_array<T, Allocator> result = heap_array<T, Allocator>::uninitialized(size, allocator);
+	view<T> data = result;
+	executor(chunks, [data, chunks] (std::size_t index) {
+		view<T> chunk = parallel_chunk(data, chunks, index);
+		std::uninitialized_value_construct(chunk.begin(), chunk.end());
+	});
+	return result;
+}
+
+/// Allocate a heap array filled with copies of a value, initializing the elements in parallel.
+/**
+ * The elements of chunk `i` (as given by parallel_chunk()) are initialized by `task(i)` run from the executor,
+ * see allocate_parallel().
+ *
+ * Only trivial types are supported, since initializing them can not throw.
+ *
+ * \throws std::invalid_argument if chunks is zero.
+ */
+template<typename T, typename Allocator = std::allocator<T>, typename Executor = thread_per_chunk>
+heap_array<T, Allocator> fill_parallel(std::size_t size, T const & value, std::size_t chunks, Executor && executor = {}, Allocator const & allocator = Allocator()) {
+	static_assert(std::is_trivial_v<T>, "parallel initialization is only supported for trivial types");
+	if (chunks == 0) throw std::invalid_argument("parallel initialization needs at least one chunk");
+	heap_array<T, Allocator> result = heap_array<T, Allocator>::uninitialized(size, allocator);
+	view<T> data = result;
+	executor(chunks, [data, chunks, &value] (std::size_t index) {
+		view<T> chunk = parallel_chunk(data, chunks, index);
+		std::uninitialized_fill(chunk.begin(), chunk.end(), value);
+	});
+	return result;
+}
+
+}
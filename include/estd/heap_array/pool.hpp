@@ -0,0 +1,279 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include "./allocator.hpp"
+#include "./heap_array.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace estd {
+
+template<typename T> class heap_array_pool;
+
+/// Allocator that takes storage from a heap_array_pool and gives it back on deallocation.
+/**
+ * A default constructed pool_allocator is not attached to a pool,
+ * and allocates directly from the global heap.
+ */
+template<typename T>
+class pool_allocator {
+	template<typename U> friend class pool_allocator;
+
+public:
+	using value_type      = T;
+	using size_type       = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using is_always_equal = std::false_type;
+	using propagate_on_container_move_assignment = std::true_type;
+
+private:
+	/// The pool to allocate from, or null to allocate from the global heap.
+	heap_array_pool<T> * pool_;
+
+public:
+	/// Create an allocator that is not attached to a pool.
+	constexpr pool_allocator() noexcept : pool_{nullptr} {}
+
+	/// Create an allocator for a pool.
+	constexpr pool_allocator(heap_array_pool<T> * pool) noexcept : pool_{pool} {}
+
+	/// Get the pool of the allocator.
+	heap_array_pool<T> * pool() const noexcept {
+		return pool_;
+	}
+
+	/// Allocate uninitialized storage for a number of elements.
+	T * allocate(std::size_t size) {
+		if (!pool_) return detail::allocate_aligned<T>(size);
+		return pool_->acquire(size);
+	}
+
+	/// Deallocate storage allocated by allocate().
+	void deallocate(T * data, std::size_t size) noexcept {
+		if (!pool_) return detail::deallocate_aligned<alignof(T)>(data);
+		pool_->recycle(data, size);
+	}
+
+	bool operator==(pool_allocator const & other) const noexcept { return pool_ == other.pool_; }
+	bool operator!=(pool_allocator const & other) const noexcept { return pool_ != other.pool_; }
+};
+
+/// Thread-safe pool of heap array storage.
+/**
+ * Arrays allocated from the pool give their storage back to the pool when they are destroyed.
+ * Later allocations of the same size class reuse that storage without going to the global heap.
+ *
+ * Allocations are rounded up to a size class.
+ * There are four size classes for every power of two, so at most 25% of an allocation is wasted.
+ *
+ * The pool can be limited in the number of bytes it keeps around for reuse.
+ * Storage that would exceed the limit is freed immediately instead.
+ *
+ * Arrays allocated from the pool must be destroyed before the pool.
+ */
+template<typename T>
+class heap_array_pool {
+	friend class pool_allocator<T>;
+
+public:
+	/// Heap array type allocated from a pool.
+	using array_type = heap_array<T, pool_allocator<T>>;
+
+	/// Statistics of a pool.
+	struct statistics {
+		/// The number of allocations served from storage in the pool.
+		std::size_t hits;
+
+		/// The number of allocations that required new storage.
+		std::size_t misses;
+
+		/// The number of bytes currently kept in the pool for reuse.
+		std::size_t retained_bytes;
+	};
+
+	/// Value for the retained bytes limit that disables the limit.
+	static constexpr std::size_t unlimited = std::size_t(-1);
+
+private:
+	/// The number of size classes per power of two, as a power of two.
+	static constexpr unsigned int sub_classes_log2_ = 2;
+
+	/// The number of size classes.
+	static constexpr std::size_t size_classes_ = (sizeof(std::size_t) * 8) << sub_classes_log2_;
+
+	/// Mutex protecting all other members.
+	mutable std::mutex mutex_;
+
+	/// Free lists for each size class.
+	std::array<std::vector<T *>, size_classes_> free_lists_;
+
+	/// The maximum number of bytes to keep for reuse.
+	std::size_t max_retained_bytes_;
+
+	/// Statistics of the pool.
+	statistics statistics_;
+
+	/// Get the size class index for a number of elements.
+	static std::size_t size_class(std::size_t size) noexcept {
+		if (size <= (std::size_t(1) << sub_classes_log2_)) return size;
+		unsigned int log2  = highest_bit(size - 1);
+		unsigned int shift = log2 - sub_classes_log2_;
+		return (std::size_t(shift) << sub_classes_log2_) + ((size - 1) >> shift) + 1;
+	}
+
+	/// Get the capacity in elements of a size class.
+	static std::size_t class_capacity(std::size_t size) noexcept {
+		if (size <= (std::size_t(1) << sub_classes_log2_)) return size;
+		unsigned int shift = highest_bit(size - 1) - sub_classes_log2_;
+		return (((size - 1) >> shift) + 1) << shift;
+	}
+
+	/// Get the capacity in elements of a size class, checking that it and its size in bytes do not overflow.
+	/**
+	 * \throws std::bad_array_new_length if the capacity or its size in bytes overflows.
+	 */
+	static std::size_t checked_class_capacity(std::size_t size) {
+		if (size > (std::size_t(1) << sub_classes_log2_)) {
+			unsigned int shift = highest_bit(size - 1) - sub_classes_log2_;
+			if (((size - 1) >> shift) + 1 > (std::size_t(-1) >> shift)) throw std::bad_array_new_length();
+		}
+		std::size_t capacity = class_capacity(size);
+		if (capacity > std::size_t(-1) / sizeof(T)) throw std::bad_array_new_length();
+		return capacity;
+	}
+
+	/// Get the index of the highest set bit of a non-zero value.
+	static unsigned int highest_bit(std::size_t value) noexcept {
+		unsigned int result = 0;
+		while (value >>= 1) ++result;
+		return result;
+	}
+
+	/// Get storage for a number of elements.
+	/**
+	 * \throws std::bad_array_new_length if the size class capacity in bytes overflows.
+	 */
+	T * acquire(std::size_t size) {
+		std::size_t capacity = checked_class_capacity(size);
+		std::size_t index    = size_class(size);
+		{
+			std::lock_guard<std::mutex> lock{mutex_};
+			std::vector<T *> & free_list = free_lists_[index];
+			if (!free_list.empty()) {
+				T * data = free_list.back();
+				free_list.pop_back();
+				statistics_.retained_bytes -= capacity * sizeof(T);
+				++statistics_.hits;
+				return data;
+			}
+			++statistics_.misses;
+		}
+		return detail::allocate_aligned<T>(capacity);
+	}
+
+	/// Give storage back to the pool.
+	void recycle(T * data, std::size_t size) noexcept {
+		std::size_t bytes = class_capacity(size) * sizeof(T);
+		{
+			std::lock_guard<std::mutex> lock{mutex_};
+			if (bytes <= max_retained_bytes_ - statistics_.retained_bytes) {
+				try {
+					free_lists_[size_class(size)].push_back(data);
+					statistics_.retained_bytes += bytes;
+					return;
+				} catch (std::bad_alloc const &) {
+					// Could not grow the free list, so free the storage instead.
+				}
+			}
+		}
+		detail::deallocate_aligned<alignof(T)>(data);
+	}
+
+public:
+	/// Create a pool.
+	/**
+	 * \param max_retained_bytes The maximum number of bytes to keep in the pool for reuse.
+	 */
+	explicit heap_array_pool(std::size_t max_retained_bytes = unlimited) :
+		max_retained_bytes_{max_retained_bytes},
+		statistics_{0, 0, 0} {}
+
+	heap_array_pool(heap_array_pool const &) = delete;
+	heap_array_pool & operator=(heap_array_pool const &) = delete;
+
+	/// Free all storage kept in the pool.
+	~heap_array_pool() {
+		trim();
+	}
+
+	/// Get an allocator that allocates from this pool.
+	pool_allocator<T> allocator() noexcept {
+		return {this};
+	}
+
+	/// Create a value-initialized array with storage from the pool.
+	array_type allocate(std::size_t size) {
+		return array_type::allocate(size, allocator());
+	}
+
+	/// Create a default-initialized array with storage from the pool.
+	/**
+	 * See heap_array::uninitialized().
+	 */
+	array_type uninitialized(std::size_t size) {
+		return array_type::uninitialized(size, allocator());
+	}
+
+	/// Free all storage kept in the pool.
+	void trim() noexcept {
+		std::lock_guard<std::mutex> lock{mutex_};
+		for (std::vector<T *> & free_list : free_lists_) {
+			for (T * data : free_list) detail::deallocate_aligned<alignof(T)>(data);
+			free_list.clear();
+		}
+		statistics_.retained_bytes = 0;
+	}
+
+	/// Get the statistics of the pool.
+	statistics stats() const {
+		std::lock_guard<std::mutex> lock{mutex_};
+		return statistics_;
+	}
+};
+
+/// Typedef for pools of byte heap arrays.
+using byte_heap_array_pool = heap_array_pool<std::uint8_t>;
+
+}
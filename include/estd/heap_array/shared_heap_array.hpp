@@ -0,0 +1,303 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include "./allocator.hpp"
+#include "../view/view.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace estd {
+
+/// An immutable, reference counted array allocated on the heap.
+/**
+ * The reference count and the elements are stored in a single allocation.
+ * Copies and slices share ownership of the same allocation,
+ * and access the elements directly without going through the reference count.
+ *
+ * The reference count is atomic, so copies can be handed to different threads.
+ * The elements themselves can not be modified after creation.
+ */
+template<typename T>
+class shared_heap_array {
+public:
+	using value_type       = T;
+	using reference        = T const &;
+	using const_reference  = T const &;
+	using iterator         = T const *;
+	using const_iterator   = T const *;
+	using difference_type  = std::ptrdiff_t;
+	using size_type        = std::size_t;
+
+private:
+	/// Header of the allocation, stored directly in front of the elements.
+	struct control_block {
+		/// The number of shared_heap_array objects referring to the allocation.
+		std::atomic<std::size_t> references;
+
+		/// The total number of elements in the allocation.
+		std::size_t size;
+	};
+
+	/// The alignment of the allocation.
+	static constexpr std::size_t alignment_ = std::max(alignof(control_block), alignof(T));
+
+	/// The offset in bytes of the elements from the start of the allocation.
+	static constexpr std::size_t data_offset_ = (sizeof(control_block) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+	/// The control block, or null for empty arrays.
+	control_block * control_;
+
+	/// The first element of this array (or slice).
+	T const * data_;
+
+	/// The number of elements in this array (or slice).
+	std::size_t size_;
+
+	/// Create an array from a control block and a range of elements, taking over one reference.
+	shared_heap_array(control_block * control, T const * data, std::size_t size) noexcept : control_{control}, data_{data}, size_{size} {}
+
+	/// Get the elements of an allocation.
+	static T * elements(control_block * control) noexcept {
+		return std::launder(reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(control) + data_offset_));
+	}
+
+	/// Allocate a control block and storage for the elements, and construct the elements with a function.
+	/**
+	 * The function is responsible for cleaning up partially constructed elements,
+	 * like the std::uninitialized_* algorithms do.
+	 */
+	template<typename F>
+	static shared_heap_array construct_with(std::size_t size, F && construct) {
+		if (!size) return shared_heap_array{};
+		if (size > (std::size_t(-1) - data_offset_) / sizeof(T)) throw std::bad_array_new_length();
+
+		unsigned char * storage = detail::allocate_aligned<unsigned char, alignment_>(data_offset_ + size * sizeof(T));
+		control_block * control = new (storage) control_block{{1}, size};
+		try {
+			construct(elements(control), size);
+		} catch (...) {
+			control->~control_block();
+			detail::deallocate_aligned<alignment_>(storage);
+			throw;
+		}
+		return shared_heap_array(control, elements(control), size);
+	}
+
+	/// Drop our reference to the allocation, destroying the elements if it was the last one.
+	void release() noexcept {
+		if (!control_) return;
+		if (control_->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			if constexpr (!std::is_trivially_destructible_v<T>) std::destroy_n(elements(control_), control_->size);
+			control_->~control_block();
+			detail::deallocate_aligned<alignment_>(reinterpret_cast<unsigned char *>(control_));
+		}
+		control_ = nullptr;
+		data_    = nullptr;
+		size_    = 0;
+	}
+
+public:
+	/// Create an empty array (does not perform any heap allocation).
+	constexpr shared_heap_array() noexcept : control_{nullptr}, data_{nullptr}, size_{0} {}
+
+	/// Create an array from a list of values.
+	shared_heap_array(std::initializer_list<T> values) : shared_heap_array(copy_from(view<T const>{values.begin(), values.size()})) {}
+
+	/// Create a new reference to the same elements.
+	shared_heap_array(shared_heap_array const & other) noexcept : control_{other.control_}, data_{other.data_}, size_{other.size_} {
+		if (control_) control_->references.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/// Move construct an array, leaving the other array empty.
+	shared_heap_array(shared_heap_array && other) noexcept :
+		control_{std::exchange(other.control_, nullptr)},
+		data_{std::exchange(other.data_, nullptr)},
+		size_{std::exchange(other.size_, 0)} {}
+
+	/// Make this array refer to the same elements as another array.
+	shared_heap_array & operator=(shared_heap_array const & other) noexcept {
+		if (this != &other) *this = shared_heap_array{other};
+		return *this;
+	}
+
+	/// Move assign an array, leaving the other array empty.
+	shared_heap_array & operator=(shared_heap_array && other) noexcept {
+		if (this != &other) {
+			release();
+			control_ = std::exchange(other.control_, nullptr);
+			data_    = std::exchange(other.data_, nullptr);
+			size_    = std::exchange(other.size_, 0);
+		}
+		return *this;
+	}
+
+	/// Drop the reference to the elements.
+	~shared_heap_array() {
+		release();
+	}
+
+	/// Create an array with a given size, and initialize it with a function before sharing it.
+	/**
+	 * The elements are default-initialized, and then passed to the function as `view<T>`.
+	 * For trivially default constructible types, the elements are left uninitialized,
+	 * so the function must write all of them.
+	 */
+	template<typename F>
+	static shared_heap_array create(std::size_t size, F && initialize) {
+		return construct_with(size, [&initialize] (T * data, std::size_t size) {
+			if constexpr (!std::is_trivially_default_constructible_v<T>) std::uninitialized_default_construct_n(data, size);
+			try {
+				std::forward<F>(initialize)(view<T>{data, size});
+			} catch (...) {
+				if constexpr (!std::is_trivially_destructible_v<T>) std::destroy_n(data, size);
+				throw;
+			}
+		});
+	}
+
+	/// Create a value-initialized array with a given size.
+	static shared_heap_array allocate(std::size_t size) {
+		return construct_with(size, [] (T * data, std::size_t size) {
+			std::uninitialized_value_construct_n(data, size);
+		});
+	}
+
+	/// Create an array holding copies of a range of elements.
+	static shared_heap_array copy_from(view<T const> values) {
+		return construct_with(values.size(), [values] (T * data, std::size_t) {
+			std::uninitialized_copy(values.begin(), values.end(), data);
+		});
+	}
+
+	/// Get a slice of the array that shares ownership of the elements.
+	/**
+	 * \throws std::range_error if the slice is out of bounds.
+	 */
+	shared_heap_array slice(std::size_t offset, std::size_t length) const {
+		if (offset > size() || length > size() - offset) {
+			throw std::range_error("slice [" + std::to_string(offset) + ", " + std::to_string(offset + length) + ") out of range, array size is " + std::to_string(size()));
+		}
+		if (length == 0) return shared_heap_array{};
+		shared_heap_array result{*this};
+		result.data_ += offset;
+		result.size_  = length;
+		return result;
+	}
+
+	/// Get the number of arrays and slices sharing the elements, or 0 for an empty array.
+	/**
+	 * When the array is shared between threads, the value may be outdated by the time it is returned.
+	 */
+	std::size_t use_count() const noexcept {
+		return control_ ? control_->references.load(std::memory_order_relaxed) : 0;
+	}
+
+	/// Get a pointer to the first element.
+	constexpr T const * begin()  const noexcept { return data_; }
+	constexpr T const * cbegin() const noexcept { return data_; }
+
+	/// Get a pointer directly past the last element.
+	constexpr T const * end()  const noexcept { return data_ + size_; }
+	constexpr T const * cend() const noexcept { return data_ + size_; }
+
+	/// Get a pointer to the data.
+	constexpr T const * data() const noexcept { return data_; }
+
+	/// Get the number of elements in the array.
+	constexpr std::size_t size() const noexcept {
+		return size_;
+	}
+
+	/// Check if the array is empty (has size 0).
+	constexpr bool empty() const noexcept {
+		return size_ == 0;
+	}
+
+	/// Get the total size of the array in bytes.
+	constexpr std::size_t byte_size() const noexcept {
+		return size() * sizeof(T);
+	}
+
+	/// Get a reverse iterator for the first element in the reversed array.
+	constexpr std::reverse_iterator<T const *> rbegin()  const noexcept { return std::make_reverse_iterator(end()); }
+	constexpr std::reverse_iterator<T const *> crbegin() const noexcept { return std::make_reverse_iterator(cend()); }
+
+	/// Get a reverse iterator for the last element in the reversed array.
+	constexpr std::reverse_iterator<T const *> rend()  const noexcept { return std::make_reverse_iterator(begin()); }
+	constexpr std::reverse_iterator<T const *> crend() const noexcept { return std::make_reverse_iterator(cbegin()); }
+
+	/// Get a reference to an element by index, without bounds checking.
+	constexpr T const & operator[] (std::size_t i) const noexcept { return data_[i]; }
+
+	/// Get a reference to an element by index, with bounds checking.
+	/**
+	 * \throws std::range_error if the index is out of bounds.
+	 */
+	T const & at(std::size_t i) const {
+		if (i >= size()) throw std::range_error("index " + std::to_string(i) + " out of range, array size is " + std::to_string(size()));
+		return data_[i];
+	}
+
+	/// Allow implicitly conversion to a non-owning view of the same data.
+	constexpr operator view<T const>() const noexcept {
+		return view<T const>{data(), size()};
+	}
+
+	/// Compare two arrays for equality.
+	/**
+	 * Two arrays are equal if their ranges of elements are equal.
+	 */
+	bool operator==(shared_heap_array const & other) const {
+		return view<T const>{data(), size()} == view<T const>{other.data(), other.size()};
+	}
+
+	/// Compare two arrays for inequality.
+	/**
+	 * Two arrays are equal if their ranges of elements are equal.
+	 */
+	bool operator!=(shared_heap_array const & other) const {
+		return !(*this == other);
+	}
+};
+
+/// Typedef for shared heap arrays of bytes.
+using shared_byte_heap_array = shared_heap_array<std::uint8_t>;
+
+}
@@ -0,0 +1,275 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include "./allocator.hpp"
+#include "../view/view.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace estd {
+
+/// An owning array type that stores up to N elements inline, and larger arrays on the heap.
+/**
+ * Like heap_array, the size is fixed when the array is created.
+ * Arrays of at most N elements do not perform any heap allocation,
+ * but moving them moves the elements one by one.
+ */
+template<typename T, std::size_t N>
+class small_heap_array {
+	static_assert(N > 0, "the inline capacity of a small_heap_array must be at least 1");
+
+public:
+	using value_type       = T;
+	using reference        = T &;
+	using const_reference  = T const &;
+	using iterator         = T *;
+	using const_iterator   = T const *;
+	using difference_type  = std::ptrdiff_t;
+	using size_type        = std::size_t;
+
+	/// The number of elements that are stored inline.
+	static constexpr std::size_t inline_capacity = N;
+
+private:
+	union {
+		/// The heap allocated data, if size_ > N.
+		T * heap_;
+
+		/// The inline storage, if size_ <= N.
+		alignas(T) unsigned char inline_[N * sizeof(T)];
+	};
+
+	/// The size of the array in elements.
+	std::size_t size_;
+
+	/// Get a pointer to the inline storage.
+	T       * inline_data()       noexcept { return std::launder(reinterpret_cast<T       *>(inline_)); }
+	T const * inline_data() const noexcept { return std::launder(reinterpret_cast<T const *>(inline_)); }
+
+	/// Allocate storage if needed and construct the elements with a function.
+	/**
+	 * The function is responsible for cleaning up partially constructed elements,
+	 * like the std::uninitialized_* algorithms do.
+	 */
+	template<typename F>
+	static small_heap_array construct_with(std::size_t size, F && construct) {
+		small_heap_array result;
+		if (size <= N) {
+			construct(result.inline_data(), size);
+		} else {
+			T * data = detail::allocate_aligned<T>(size);
+			try {
+				construct(data, size);
+			} catch (...) {
+				detail::deallocate_aligned<alignof(T)>(data);
+				throw;
+			}
+			result.heap_ = data;
+		}
+		result.size_ = size;
+		return result;
+	}
+
+	/// Destroy all elements and release the storage.
+	void release() noexcept {
+		if constexpr (!std::is_trivially_destructible_v<T>) std::destroy_n(data(), size_);
+		if (!is_inline()) detail::deallocate_aligned<alignof(T)>(heap_);
+		size_ = 0;
+	}
+
+	/// Take over the elements of another array, leaving it empty.
+	void steal(small_heap_array & other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+		if (other.is_inline()) {
+			std::uninitialized_move_n(other.inline_data(), other.size_, inline_data());
+			if constexpr (!std::is_trivially_destructible_v<T>) std::destroy_n(other.inline_data(), other.size_);
+		} else {
+			heap_ = other.heap_;
+		}
+		size_ = std::exchange(other.size_, 0);
+	}
+
+public:
+	/// Create an empty array.
+	small_heap_array() noexcept : size_{0} {}
+
+	/// Create an array from list of values.
+	/**
+	 * Note that the values will be copied into the array,
+	 * since initializer lists only give const access to their contents.
+	 */
+	small_heap_array(std::initializer_list<T> data) : small_heap_array(construct_with(data.size(), [&data] (T * storage, std::size_t) {
+		std::uninitialized_copy(data.begin(), data.end(), storage);
+	})) {}
+
+	/// Move construct an array, leaving the other array empty.
+	/**
+	 * Inline elements are moved one by one, heap allocated elements are taken over directly.
+	 */
+	small_heap_array(small_heap_array && other) noexcept(std::is_nothrow_move_constructible_v<T>) : size_{0} {
+		steal(other);
+	}
+
+	/// Move assign an array, leaving the other array empty.
+	small_heap_array & operator=(small_heap_array && other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+		if (this != &other) {
+			release();
+			steal(other);
+		}
+		return *this;
+	}
+
+	small_heap_array(small_heap_array const &) = delete;
+	small_heap_array & operator=(small_heap_array const &) = delete;
+
+	/// Destroy the elements and free the storage.
+	~small_heap_array() {
+		release();
+	}
+
+	/// Create a value-initialized array with a given size.
+	static small_heap_array allocate(std::size_t size) {
+		return construct_with(size, [] (T * data, std::size_t size) {
+			std::uninitialized_value_construct_n(data, size);
+		});
+	}
+
+	/// Create a default-initialized array with a given size.
+	/**
+	 * See heap_array::uninitialized().
+	 */
+	static small_heap_array uninitialized(std::size_t size) {
+		return construct_with(size, [] (T * data, std::size_t size) {
+			if constexpr (!std::is_trivially_default_constructible_v<T>) std::uninitialized_default_construct_n(data, size);
+		});
+	}
+
+	/// Check if the elements are stored inline.
+	constexpr bool is_inline() const noexcept {
+		return size_ <= N;
+	}
+
+	/// Get a pointer to the first element.
+	T       * begin()        noexcept { return data(); }
+	T const * begin()  const noexcept { return data(); }
+	T const * cbegin() const noexcept { return data(); }
+
+	/// Get a pointer directly past the last element.
+	T       * end()        noexcept { return begin() + size(); }
+	T const * end()  const noexcept { return begin() + size(); }
+	T const * cend() const noexcept { return begin() + size(); }
+
+	/// Get a pointer to the data.
+	T       * data()        noexcept { return is_inline() ? inline_data() : heap_; }
+	T const * data()  const noexcept { return is_inline() ? inline_data() : heap_; }
+
+	/// Get the number of elements in the array.
+	constexpr std::size_t size() const noexcept {
+		return size_;
+	}
+
+	/// Check if the array is empty (has size 0).
+	constexpr bool empty() const noexcept {
+		return size_ == 0;
+	}
+
+	/// Get the total size of the array in bytes.
+	constexpr std::size_t byte_size() const noexcept {
+		return size() * sizeof(T);
+	}
+
+	/// Get a reverse iterator for the first element in the reversed array.
+	std::reverse_iterator<T       *> rbegin()        noexcept { return std::make_reverse_iterator(end()); }
+	std::reverse_iterator<T const *> rbegin()  const noexcept { return std::make_reverse_iterator(end()); }
+	std::reverse_iterator<T const *> crbegin() const noexcept { return std::make_reverse_iterator(cend()); }
+
+	/// Get a reverse iterator for the last element in the reversed array.
+	std::reverse_iterator<T       *> rend()        noexcept { return std::make_reverse_iterator(begin()); }
+	std::reverse_iterator<T const *> rend()  const noexcept { return std::make_reverse_iterator(begin()); }
+	std::reverse_iterator<T const *> crend() const noexcept { return std::make_reverse_iterator(cbegin()); }
+
+	/// Get a reference to an element by index, without bounds checking.
+	T       & operator[] (std::size_t i)       noexcept { return begin()[i]; }
+	T const & operator[] (std::size_t i) const noexcept { return begin()[i]; }
+
+	/// Get a reference to an element by index, with bounds checking.
+	/**
+	 * \throws std::range_error if the index is out of bounds.
+	 */
+	T const & at(std::size_t i) const {
+		if (i >= size()) throw std::range_error("index " + std::to_string(i) + " out of range, array size is " + std::to_string(size()));
+		return begin()[i];
+	}
+
+	/// Get a reference to an element by index, with bounds checking.
+	/**
+	 * \throws std::range_error if the index is out of bounds.
+	 */
+	T & at(std::size_t i) {
+		if (i >= size()) throw std::range_error("index " + std::to_string(i) + " out of range, array size is " + std::to_string(size()));
+		return begin()[i];
+	}
+
+	/// Allow implicitly conversion to a non-owning view of the same data.
+	operator view<T>() noexcept {
+		return view<T>{data(), size()};
+	}
+
+	/// Allow implicitly conversion to a non-owning view of the same data.
+	operator view<T const>() const noexcept {
+		return view<T const>{data(), size()};
+	}
+
+	/// Compare two arrays for equality.
+	/**
+	 * Two arrays are equal if their ranges of elements are equal.
+	 */
+	bool operator==(small_heap_array const & other) const {
+		return view<T const>{data(), size()} == view<T const>{other.data(), other.size()};
+	}
+
+	/// Compare two arrays for inequality.
+	/**
+	 * Two arrays are equal if their ranges of elements are equal.
+	 */
+	bool operator!=(small_heap_array const & other) const {
+		return !(*this == other);
+	}
+};
+
+}
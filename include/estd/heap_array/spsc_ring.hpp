@@ -0,0 +1,254 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "./heap_array.hpp"
+#include "../utility/cpu_features.hpp"
+#include "../view/view.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace estd {
+
+/// One or two contiguous regions of a ring buffer.
+/**
+ * The second region is only non-empty if the range wraps around the end of the buffer.
+ */
+template<typename T>
+struct ring_regions {
+	/// The region starting at the current position.
+	view<T> first;
+
+	/// The region continuing at the start of the buffer.
+	view<T> second;
+
+	/// Get the total number of elements in both regions.
+	std::size_t size() const { return first.size() + second.size(); }
+
+	/// Check if both regions are empty.
+	bool empty() const { return size() == 0; }
+};
+
+/// Lock-free ring buffer for passing elements from a single producer thread to a single consumer thread.
+/**
+ * The capacity is a power of two, so positions wrap with a mask.
+ * All slots of the buffer always hold live (default constructed, written or moved-from) elements,
+ * so producers can write in place through the views from prepare_push() or push_n().
+ *
+ * The producer and consumer indices are kept on separate cache lines, together with the cached copy
+ * of the other thread's index, so the threads only share a cache line when the ring runs (nearly) full or empty.
+ *
+ * Only one thread may call the producer functions (try_push(), prepare_push(), commit_push(), push_n())
+ * and only one thread may call the consumer functions (try_pop(), prepare_pop(), commit_pop(), pop_n()) at a time.
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class spsc_ring {
+	static_assert(std::is_default_constructible_v<T>, "spsc_ring elements must be default constructible");
+
+	/// Round a capacity up to a power of two.
+	static std::size_t round_capacity(std::size_t capacity) {
+		if (capacity == 0) throw std::invalid_argument("spsc_ring capacity must not be zero");
+		if (capacity > (std::size_t(-1) >> 1) + 1) throw std::length_error("spsc_ring capacity too large: " + std::to_string(capacity));
+		std::size_t result = 1;
+		while (result < capacity) result <<= 1;
+		return result;
+	}
+
+	/// The slots of the ring.
+	heap_array<T, Allocator> buffer_;
+
+	/// Mask to turn a position into a slot index.
+	std::size_t mask_;
+
+	/// The producer position: the total number of elements ever pushed.
+	alignas(cache_line_size) std::atomic<std::size_t> head_;
+
+	/// The consumer position as last seen by the producer.
+	std::size_t cached_tail_;
+
+	/// The consumer position: the total number of elements ever popped.
+	alignas(cache_line_size) std::atomic<std::size_t> tail_;
+
+	/// The producer position as last seen by the consumer.
+	std::size_t cached_head_;
+
+	/// Get the regions for a number of slots starting at a position.
+	ring_regions<T> regions(std::size_t position, std::size_t count) {
+		std::size_t start = position & mask_;
+		std::size_t first = std::min(count, capacity() - start);
+		return {{buffer_.data() + start, first}, {buffer_.data(), count - first}};
+	}
+
+public:
+	/// Create a ring with room for at least a number of elements.
+	/**
+	 * The capacity is rounded up to a power of two.
+	 *
+	 * \throws std::invalid_argument if the capacity is zero.
+	 */
+	explicit spsc_ring(std::size_t capacity, Allocator const & allocator = Allocator()) :
+		buffer_{heap_array<T, Allocator>::allocate(round_capacity(capacity), allocator)},
+		mask_{buffer_.size() - 1},
+		head_{0},
+		cached_tail_{0},
+		tail_{0},
+		cached_head_{0} {}
+
+	spsc_ring(spsc_ring const &) = delete;
+	spsc_ring & operator=(spsc_ring const &) = delete;
+
+	/// Get the maximum number of elements in the ring.
+	std::size_t capacity() const noexcept { return buffer_.size(); }
+
+	/// Get the number of elements in the ring.
+	/**
+	 * When called while the other thread is active, the result may be outdated immediately.
+	 */
+	std::size_t size() const noexcept {
+		std::size_t tail = tail_.load(std::memory_order_acquire);
+		return head_.load(std::memory_order_acquire) - tail;
+	}
+
+	/// Check if the ring is empty.
+	/**
+	 * When called while the other thread is active, the result may be outdated immediately.
+	 */
+	bool empty() const noexcept { return size() == 0; }
+
+	/// Get the free slots for up to a number of elements, for the producer to write in place.
+	/**
+	 * The returned regions may hold fewer slots than requested if the ring is (nearly) full.
+	 * The written elements become visible to the consumer after commit_push().
+	 */
+	ring_regions<T> prepare_push(std::size_t count) {
+		std::size_t head = head_.load(std::memory_order_relaxed);
+		if (capacity() - (head - cached_tail_) < count) cached_tail_ = tail_.load(std::memory_order_acquire);
+		return regions(head, std::min(count, capacity() - (head - cached_tail_)));
+	}
+
+	/// Publish a number of elements written to the regions from prepare_push().
+	/**
+	 * \throws std::logic_error if there are not enough free slots for the elements.
+	 */
+	void commit_push(std::size_t count) {
+		std::size_t head = head_.load(std::memory_order_relaxed);
+		if (count > capacity() - (head - cached_tail_)) {
+			throw std::logic_error("spsc_ring: attempted to commit " + std::to_string(count) + " elements, but only " + std::to_string(capacity() - (head - cached_tail_)) + " slots were prepared");
+		}
+		head_.store(head + count, std::memory_order_release);
+	}
+
+	/// Get the available elements up to a number, for the consumer to read or move from in place.
+	/**
+	 * The returned regions may hold fewer elements than requested if the ring is (nearly) empty.
+	 * The slots are handed back to the producer by commit_pop().
+	 */
+	ring_regions<T> prepare_pop(std::size_t count) {
+		std::size_t tail = tail_.load(std::memory_order_relaxed);
+		if (cached_head_ - tail < count) cached_head_ = head_.load(std::memory_order_acquire);
+		return regions(tail, std::min(count, cached_head_ - tail));
+	}
+
+	/// Release a number of elements consumed from the regions from prepare_pop().
+	/**
+	 * \throws std::logic_error if there are not that many available elements.
+	 */
+	void commit_pop(std::size_t count) {
+		std::size_t tail = tail_.load(std::memory_order_relaxed);
+		if (count > cached_head_ - tail) {
+			throw std::logic_error("spsc_ring: attempted to release " + std::to_string(count) + " elements, but only " + std::to_string(cached_head_ - tail) + " were prepared");
+		}
+		tail_.store(tail + count, std::memory_order_release);
+	}
+
+	/// Push up to a number of elements by writing them in place.
+	/**
+	 * The function is called with a view<T> for each contiguous region of free slots (at most two),
+	 * and must write all elements in the region.
+	 * The elements are published together when the function returns.
+	 *
+	 * \return The number of elements pushed, which is less than requested if the ring is (nearly) full.
+	 */
+	template<typename F>
+	std::size_t push_n(std::size_t count, F && write) {
+		ring_regions<T> slots = prepare_push(count);
+		if (slots.first.size() > 0) write(slots.first);
+		if (slots.second.size() > 0) write(slots.second);
+		commit_push(slots.size());
+		return slots.size();
+	}
+
+	/// Pop up to a number of elements by reading them in place.
+	/**
+	 * The function is called with a view<T> for each contiguous region of available elements (at most two).
+	 * It may read the elements or move from them.
+	 * The slots are released together when the function returns.
+	 *
+	 * \return The number of elements popped, which is less than requested if the ring is (nearly) empty.
+	 */
+	template<typename F>
+	std::size_t pop_n(std::size_t count, F && read) {
+		ring_regions<T> elements = prepare_pop(count);
+		if (elements.first.size() > 0) read(elements.first);
+		if (elements.second.size() > 0) read(elements.second);
+		commit_pop(elements.size());
+		return elements.size();
+	}
+
+	/// Push a single element, if there is room.
+	/**
+	 * \return True if the element was pushed, false if the ring is full.
+	 */
+	bool try_push(T value) {
+		ring_regions<T> slots = prepare_push(1);
+		if (slots.empty()) return false;
+		slots.first[0] = std::move(value);
+		commit_push(1);
+		return true;
+	}
+
+	/// Pop a single element, if there is one.
+	std::optional<T> try_pop() {
+		ring_regions<T> elements = prepare_pop(1);
+		if (elements.empty()) return std::nullopt;
+		std::optional<T> result{std::move(elements.first[0])};
+		commit_pop(1);
+		return result;
+	}
+};
+
+}
@@ -0,0 +1,261 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include "../result/error.hpp"
+#include "../result/result.hpp"
+#include "../view/view.hpp"
+#include "../view/view_cast.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace estd {
+
+/// The mode to map a file with.
+enum class map_mode {
+	/// Map the file read-only.
+	read_only,
+
+	/// Map the file for reading and writing.
+	/**
+	 * Writes to the mapped memory are written back to the file.
+	 */
+	read_write,
+};
+
+/// Hints about the expected access pattern of mapped memory.
+enum class map_advice {
+	/// No special treatment.
+	normal,
+
+	/// Expect sequential access: read ahead aggressively and free pages after they have been read.
+	sequential,
+
+	/// Expect random access: read ahead less.
+	random,
+
+	/// Expect access in the near future: start reading pages in now.
+	will_need,
+
+	/// Do not expect access in the near future: pages may be dropped from memory.
+	dont_need,
+};
+
+/// A memory mapped file.
+/**
+ * The file is mapped as a shared mapping, so the pages are shared with the page cache
+ * and with other processes mapping the same file.
+ * Pages are only read from disk when they are accessed.
+ *
+ * The mapping is removed when the mapped_file is destroyed.
+ * The file itself does not need to stay open.
+ */
+class mapped_file {
+	/// The mapped data.
+	std::uint8_t * data_;
+
+	/// The size of the mapping in bytes.
+	std::size_t size_;
+
+	/// The mode of the mapping.
+	map_mode mode_;
+
+	/// Take ownership of a mapping.
+	mapped_file(std::uint8_t * data, std::size_t size, map_mode mode) noexcept : data_{data}, size_{size}, mode_{mode} {}
+
+	/// Remove the mapping.
+	void release() noexcept {
+		if (data_) ::munmap(data_, size_);
+		data_ = nullptr;
+		size_ = 0;
+	}
+
+	/// Get the page size of the system.
+	static std::size_t page_size() noexcept {
+		static std::size_t const size = ::sysconf(_SC_PAGESIZE);
+		return size;
+	}
+
+public:
+	/// Create an empty mapped_file that does not map anything.
+	mapped_file() noexcept : data_{nullptr}, size_{0}, mode_{map_mode::read_only} {}
+
+	mapped_file(mapped_file const &) = delete;
+	mapped_file & operator=(mapped_file const &) = delete;
+
+	/// Move construct a mapped_file, leaving the other one empty.
+	mapped_file(mapped_file && other) noexcept :
+		data_{std::exchange(other.data_, nullptr)},
+		size_{std::exchange(other.size_, 0)},
+		mode_{other.mode_} {}
+
+	/// Move assign a mapped_file, leaving the other one empty.
+	mapped_file & operator=(mapped_file && other) noexcept {
+		if (this != &other) {
+			release();
+			data_ = std::exchange(other.data_, nullptr);
+			size_ = std::exchange(other.size_, 0);
+			mode_ = other.mode_;
+		}
+		return *this;
+	}
+
+	/// Unmap the file.
+	~mapped_file() {
+		release();
+	}
+
+	/// Map a file into memory.
+	/**
+	 * The whole file is mapped.
+	 * Mapping an empty file succeeds and gives an empty mapped_file.
+	 */
+	static result<mapped_file, error> open(std::string const & path, map_mode mode = map_mode::read_only) {
+		int flags = mode == map_mode::read_write ? O_RDWR : O_RDONLY;
+		int fd = ::open(path.c_str(), flags | O_CLOEXEC);
+		if (fd < 0) return error::last_os_error("failed to open " + path);
+
+		struct ::stat info;
+		if (::fstat(fd, &info) != 0) {
+			error result = error::last_os_error("failed to stat " + path);
+			::close(fd);
+			return result;
+		}
+
+		std::size_t size = info.st_size;
+		if (size == 0) {
+			::close(fd);
+			return {in_place_valid, mapped_file{nullptr, 0, mode}};
+		}
+
+		int protection = mode == map_mode::read_write ? PROT_READ | PROT_WRITE : PROT_READ;
+		void * data = ::mmap(nullptr, size, protection, MAP_SHARED, fd, 0);
+		if (data == MAP_FAILED) {
+			error result = error::last_os_error("failed to map " + path);
+			::close(fd);
+			return result;
+		}
+
+		::close(fd);
+		return {in_place_valid, mapped_file{static_cast<std::uint8_t *>(data), size, mode}};
+	}
+
+	/// Get the size of the mapping in bytes.
+	std::size_t size() const noexcept {
+		return size_;
+	}
+
+	/// Check if the mapping is empty.
+	bool empty() const noexcept {
+		return size_ == 0;
+	}
+
+	/// Get the mode of the mapping.
+	map_mode mode() const noexcept {
+		return mode_;
+	}
+
+	/// Check if the mapping is writable.
+	bool writable() const noexcept {
+		return mode_ == map_mode::read_write;
+	}
+
+	/// Get a pointer to the mapped data.
+	std::uint8_t const * data() const noexcept {
+		return data_;
+	}
+
+	/// Get a view of the mapped bytes.
+	byte_view bytes() const noexcept {
+		return {data_, size_};
+	}
+
+	/// Get a mutable view of the mapped bytes.
+	/**
+	 * \throws std::logic_error if the file is not mapped for writing.
+	 */
+	mut_byte_view mut_bytes() {
+		if (!writable()) throw std::logic_error("attempted to get mutable view of read-only mapped file");
+		return {data_, size_};
+	}
+
+	/// Get a typed view of the mapped data.
+	/**
+	 * Fails with std::errc::invalid_argument if the size of the file is not a multiple of sizeof(T),
+	 * or if the mapping is not suitably aligned for T.
+	 */
+	template<typename T>
+	result<view<T const>, error> as_view() const {
+		static_assert(std::is_trivially_copyable_v<T>, "mapped data can only be viewed as trivially copyable types");
+		return view_cast<T const>(bytes());
+	}
+
+	/// Give the kernel a hint about how a range of the mapping will be accessed.
+	/**
+	 * The offset is rounded down to a page boundary.
+	 * By default, the hint applies to the whole mapping.
+	 */
+	result<void, error> advise(map_advice advice, std::size_t offset = 0, std::size_t length = std::size_t(-1)) const {
+		if (!data_ || offset >= size_) return {in_place_valid};
+		length = std::min(length, size_ - offset);
+		std::size_t aligned_offset = offset - offset % page_size();
+		length += offset - aligned_offset;
+
+		int native = MADV_NORMAL;
+		switch (advice) {
+			case map_advice::normal:     native = MADV_NORMAL;     break;
+			case map_advice::sequential: native = MADV_SEQUENTIAL; break;
+			case map_advice::random:     native = MADV_RANDOM;     break;
+			case map_advice::will_need:  native = MADV_WILLNEED;   break;
+			case map_advice::dont_need:  native = MADV_DONTNEED;   break;
+		}
+
+		if (::madvise(data_ + aligned_offset, length, native) != 0) return error::last_os_error("failed to advise kernel on mapped file access");
+		return {in_place_valid};
+	}
+
+	/// Write changes to a writable mapping back to the file, and wait for the write to complete.
+	result<void, error> sync() const {
+		if (!data_ || !writable()) return {in_place_valid};
+		if (::msync(data_, size_, MS_SYNC) != 0) return error::last_os_error("failed to synchronize mapped file");
+		return {in_place_valid};
+	}
+};
+
+}
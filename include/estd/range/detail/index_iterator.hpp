@@ -0,0 +1,88 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include "deref_proxy.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace estd {
+namespace detail {
+	/// Random access iterator that produces elements by indexing into a source object.
+	/**
+	 * The source is held by value, so it should be a cheap to copy view-like type.
+	 * Dereferencing the iterator returns `source[index]` by value.
+	 */
+	template<typename Source>
+	class index_iterator {
+	public:
+		using value_type        = std::decay_t<decltype(std::declval<Source const &>()[std::size_t()])>;
+		using difference_type   = std::ptrdiff_t;
+		using reference         = value_type;
+		using pointer           = DerefProxy<value_type>;
+		using iterator_category = std::random_access_iterator_tag;
+
+	private:
+		Source source_;
+		std::size_t index_;
+
+	public:
+		index_iterator() : source_{}, index_{0} {}
+		index_iterator(Source source, std::size_t index) : source_{std::move(source)}, index_{index} {}
+
+		/// Get the index of the iterator in the source.
+		std::size_t index() const { return index_; }
+
+		value_type operator*() const { return source_[index_]; }
+		pointer operator->() const { return {**this}; }
+		value_type operator[](difference_type n) const { return source_[index_ + n]; }
+
+		index_iterator & operator++() { ++index_; return *this; }
+		index_iterator & operator--() { --index_; return *this; }
+		index_iterator operator++(int) { index_iterator old = *this; ++index_; return old; }
+		index_iterator operator--(int) { index_iterator old = *this; --index_; return old; }
+
+		index_iterator & operator+=(difference_type n) { index_ += n; return *this; }
+		index_iterator & operator-=(difference_type n) { index_ -= n; return *this; }
+
+		friend index_iterator operator+(index_iterator it, difference_type n) { return it += n; }
+		friend index_iterator operator+(difference_type n, index_iterator it) { return it += n; }
+		friend index_iterator operator-(index_iterator it, difference_type n) { return it -= n; }
+		difference_type operator-(index_iterator const & other) const { return difference_type(index_) - difference_type(other.index_); }
+
+		bool operator==(index_iterator const & other) const { return index_ == other.index_; }
+		bool operator!=(index_iterator const & other) const { return index_ != other.index_; }
+		bool operator< (index_iterator const & other) const { return index_ <  other.index_; }
+		bool operator> (index_iterator const & other) const { return index_ >  other.index_; }
+		bool operator<=(index_iterator const & other) const { return index_ <= other.index_; }
+		bool operator>=(index_iterator const & other) const { return index_ >= other.index_; }
+	};
+}}
@@ -33,8 +33,14 @@
 
 namespace estd {
 
-template<typename T> using iterator_type               = std::decay_t<decltype(begin(std::declval<T &>()))>;
-template<typename T> using const_iterator_type         = std::decay_t<decltype(begin(std::declval<T const &>()))>;
+namespace detail {
+	using std::begin;
+	template<typename T> using iterator_type       = std::decay_t<decltype(begin(std::declval<T &>()))>;
+	template<typename T> using const_iterator_type = std::decay_t<decltype(begin(std::declval<T const &>()))>;
+}
+
+template<typename T> using iterator_type               = detail::iterator_type<T>;
+template<typename T> using const_iterator_type         = detail::const_iterator_type<T>;
 template<typename T> using reverse_iterator_type       = std::decay_t<decltype(std::declval<T &>().rbegin())>;
 template<typename T> using const_reverse_iterator_type = std::decay_t<decltype(std::declval<T const &>().rend())>;
 
@@ -28,6 +28,7 @@
 
 #pragma once
 #include "utility/integer_sequence.hpp"
+#include "utility/cpu_features.hpp"
 #include "utility/make_ref.hpp"
 #include "utility/move_marker.hpp"
 #include "utility/parameter_pack.hpp"
@@ -0,0 +1,83 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+/// Defined when kernels for specific x86 instruction sets can be selected at runtime.
+/**
+ * Such kernels are compiled with ESTD_TARGET("...") so the rest of the
+ * translation unit can keep a lower baseline instruction set.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#  define ESTD_HAVE_X86_DISPATCH 1
+#  define ESTD_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+#include <cstddef>
+
+namespace estd {
+
+/// The assumed size of a cache line in bytes, used to keep data written by different threads apart.
+/**
+ * This is the cache line size of current x86-64 and most ARM cores.
+ * std::hardware_destructive_interference_size is not used because its value may differ between compiler flags.
+ */
+constexpr std::size_t cache_line_size = 64;
+
+/// Check if the CPU running the program supports SSE4.2.
+inline bool cpu_has_sse42() noexcept {
+#ifdef ESTD_HAVE_X86_DISPATCH
+	static bool const supported = (__builtin_cpu_init(), __builtin_cpu_supports("sse4.2"));
+	return supported;
+#else
+	return false;
+#endif
+}
+
+/// Check if the CPU running the program supports the popcnt instruction.
+inline bool cpu_has_popcnt() noexcept {
+#ifdef ESTD_HAVE_X86_DISPATCH
+	static bool const supported = (__builtin_cpu_init(), __builtin_cpu_supports("popcnt"));
+	return supported;
+#else
+	return false;
+#endif
+}
+
+/// Check if the CPU running the program supports AVX2.
+inline bool cpu_has_avx2() noexcept {
+#ifdef ESTD_HAVE_X86_DISPATCH
+	static bool const supported = (__builtin_cpu_init(), __builtin_cpu_supports("avx2"));
+	return supported;
+#else
+	return false;
+#endif
+}
+
+}
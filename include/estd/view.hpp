@@ -28,3 +28,17 @@
 
 #pragma once
 #include "view/view.hpp"
+#include "view/view_cast.hpp"
+#include "view/aligned_view.hpp"
+#include "view/nd_view.hpp"
+#include "view/strided_view.hpp"
+#include "view/search.hpp"
+#include "view/split.hpp"
+#include "view/chunks.hpp"
+#include "view/bit_view.hpp"
+
+#if defined(__has_include)
+#  if __has_include(<sys/uio.h>)
+#    include "view/view_list.hpp"
+#  endif
+#endif
@@ -0,0 +1,137 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "./view.hpp"
+#include "../result/error.hpp"
+#include "../result/result.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace estd {
+
+/// A non-owning view on a range of elements with data aligned to a known alignment.
+/**
+ * The alignment is part of the type, so functions taking an aligned_view can rely on it
+ * without checking at runtime, for example to use aligned SIMD loads.
+ *
+ * An aligned_view can be created from a view with create(), which checks the alignment,
+ * or from a heap array with a large enough alignment, see aligned_heap_array.
+ * It converts implicitly to a plain view and to an aligned_view with a smaller alignment.
+ */
+template<typename T, std::size_t Alignment>
+class aligned_view {
+	static_assert((Alignment & (Alignment - 1)) == 0, "alignment must be a power of two");
+	static_assert(Alignment >= alignof(T), "alignment must be at least the natural alignment of T");
+
+public:
+	using value_type       = T;
+	using reference        = T &;
+	using const_reference  = T const &;
+	using iterator         = T *;
+	using const_iterator   = T const *;
+	using difference_type  = std::ptrdiff_t;
+	using size_type        = std::size_t;
+
+	/// The guaranteed alignment of data() in bytes.
+	static constexpr std::size_t alignment = Alignment;
+
+private:
+	/// The viewed data.
+	view<T> data_;
+
+	/// Create an aligned view without checking the alignment.
+	constexpr explicit aligned_view(view<T> data) noexcept : data_{data} {}
+
+public:
+	/// Create an empty aligned view.
+	constexpr aligned_view() noexcept : data_{static_cast<T *>(nullptr), std::size_t(0)} {}
+
+	/// Allow implicit conversion from an aligned view with a larger alignment or a less const element type.
+	template<typename U, std::size_t OtherAlignment, typename = std::enable_if_t<
+		(OtherAlignment >= Alignment) && (std::is_same_v<U, T> || std::is_same_v<U const, T>)
+	>>
+	constexpr aligned_view(aligned_view<U, OtherAlignment> other) noexcept : data_{other.data(), other.size()} {}
+
+	/// Create an aligned view from a view, checking the alignment.
+	/**
+	 * Fails with std::errc::invalid_argument if the data is not aligned to `Alignment` bytes.
+	 * An empty view with a null data pointer is always aligned.
+	 */
+	static result<aligned_view, error> create(view<T> data) {
+		if (reinterpret_cast<std::uintptr_t>(data.data()) % Alignment != 0) {
+			return error{std::errc::invalid_argument, "view data is not aligned to " + std::to_string(Alignment) + " bytes"};
+		}
+		return aligned_view{data};
+	}
+
+	/// Create an aligned view from a view that is known to be aligned, without checking.
+	/**
+	 * The behaviour is undefined if the data is not aligned to `Alignment` bytes.
+	 */
+	static constexpr aligned_view assume_aligned(view<T> data) noexcept {
+		return aligned_view{data};
+	}
+
+	/// Get a pointer to the data.
+	constexpr T * data() const noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		return static_cast<T *>(__builtin_assume_aligned(data_.data(), Alignment));
+#else
+		return data_.data();
+#endif
+	}
+
+	/// Get a pointer to the first element.
+	constexpr T * begin() const noexcept { return data(); }
+
+	/// Get a pointer directly past the last element.
+	constexpr T * end() const noexcept { return data_.end(); }
+
+	/// Get the number of elements in the view.
+	constexpr std::size_t size() const noexcept { return data_.size(); }
+
+	/// Get the total size of the view in bytes.
+	constexpr std::size_t byte_size() const noexcept { return data_.byte_size(); }
+
+	/// Get a reference to an element by index, without bounds checking.
+	constexpr T & operator[] (std::size_t i) const { return data()[i]; }
+
+	/// Allow implicit conversion to a plain view.
+	constexpr operator view<T>() const noexcept { return data_; }
+
+	/// Allow implicit conversion to a plain const view.
+	template<typename U = T, typename = std::enable_if_t<!std::is_const_v<U>>>
+	constexpr operator view<T const>() const noexcept { return {data_.data(), data_.size()}; }
+};
+
+}
@@ -0,0 +1,440 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "./view.hpp"
+#include "../range/detail/index_iterator.hpp"
+#include "../utility/cpu_features.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(ESTD_HAVE_X86_DISPATCH)
+#  include <immintrin.h>
+#endif
+
+namespace estd {
+
+namespace detail::bits {
+	using word = std::uint64_t;
+
+	/// The number of bits in a storage word.
+	constexpr std::size_t bits_per_word = 64;
+
+	/// Get the number of words needed to store a number of bits.
+	constexpr std::size_t word_count(std::size_t bits) {
+		return (bits + bits_per_word - 1) / bits_per_word;
+	}
+
+	/// Get a mask of the used bits in the last word of a bit sequence.
+	constexpr word tail_mask(std::size_t bits) {
+		return bits % bits_per_word == 0 ? ~word(0) : (word(1) << (bits % bits_per_word)) - 1;
+	}
+
+	/// Bitwise operation to combine two masks with.
+	enum class bit_op { and_, or_, xor_, and_not };
+
+	template<bit_op Op>
+	constexpr word apply(word a, word b) {
+		if constexpr (Op == bit_op::and_) return a & b;
+		if constexpr (Op == bit_op::or_)  return a | b;
+		if constexpr (Op == bit_op::xor_) return a ^ b;
+		if constexpr (Op == bit_op::and_not) return a & ~b;
+	}
+
+	template<bit_op Op>
+	void apply_scalar(word * target, word const * source, std::size_t count) {
+		for (std::size_t i = 0; i < count; ++i) target[i] = apply<Op>(target[i], source[i]);
+	}
+
+#if defined(__SSE2__)
+	template<bit_op Op>
+	void apply_sse2(word * target, word const * source, std::size_t count) {
+		std::size_t i = 0;
+		for (; i + 2 <= count; i += 2) {
+			__m128i a = _mm_loadu_si128(reinterpret_cast<__m128i const *>(target + i));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<__m128i const *>(source + i));
+			if constexpr (Op == bit_op::and_) a = _mm_and_si128(a, b);
+			if constexpr (Op == bit_op::or_)  a = _mm_or_si128(a, b);
+			if constexpr (Op == bit_op::xor_) a = _mm_xor_si128(a, b);
+			if constexpr (Op == bit_op::and_not) a = _mm_andnot_si128(b, a);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(target + i), a);
+		}
+		apply_scalar<Op>(target + i, source + i, count - i);
+	}
+#endif
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+	template<bit_op Op>
+	ESTD_TARGET("avx2") void apply_avx2(word * target, word const * source, std::size_t count) {
+		std::size_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(target + i));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(source + i));
+			if constexpr (Op == bit_op::and_) a = _mm256_and_si256(a, b);
+			if constexpr (Op == bit_op::or_)  a = _mm256_or_si256(a, b);
+			if constexpr (Op == bit_op::xor_) a = _mm256_xor_si256(a, b);
+			if constexpr (Op == bit_op::and_not) a = _mm256_andnot_si256(b, a);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(target + i), a);
+		}
+		for (; i < count; ++i) target[i] = apply<Op>(target[i], source[i]);
+	}
+#endif
+
+	/// Combine whole words of a source mask into a target mask.
+	template<bit_op Op>
+	void apply_words(word * target, word const * source, std::size_t count) {
+#ifdef ESTD_HAVE_X86_DISPATCH
+		if (cpu_has_avx2()) return apply_avx2<Op>(target, source, count);
+#endif
+#if defined(__SSE2__)
+		apply_sse2<Op>(target, source, count);
+#else
+		apply_scalar<Op>(target, source, count);
+#endif
+	}
+
+	inline std::size_t popcount_scalar(word const * data, std::size_t count) {
+		std::size_t result = 0;
+		for (std::size_t i = 0; i < count; ++i) result += __builtin_popcountll(data[i]);
+		return result;
+	}
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+	ESTD_TARGET("popcnt") inline std::size_t popcount_popcnt(word const * data, std::size_t count) {
+		std::size_t result = 0;
+		for (std::size_t i = 0; i < count; ++i) result += __builtin_popcountll(data[i]);
+		return result;
+	}
+
+	/// Count bits with a nibble lookup table in vector registers, summing the byte counts with vpsadbw.
+	ESTD_TARGET("avx2") inline std::size_t popcount_avx2(word const * data, std::size_t count) {
+		__m256i const lookup = _mm256_setr_epi8(
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+		);
+		__m256i const low_nibbles = _mm256_set1_epi8(0x0f);
+		__m256i total = _mm256_setzero_si256();
+
+		std::size_t i = 0;
+		while (i + 4 <= count) {
+			// Byte counts can reach 8 per block, so sum them into 64 bit lanes at least every 31 blocks.
+			__m256i bytes = _mm256_setzero_si256();
+			std::size_t end = std::min(count - count % 4, i + 4 * 31);
+			for (; i < end; i += 4) {
+				__m256i block = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + i));
+				__m256i low   = _mm256_shuffle_epi8(lookup, _mm256_and_si256(block, low_nibbles));
+				__m256i high  = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(block, 4), low_nibbles));
+				bytes = _mm256_add_epi8(bytes, _mm256_add_epi8(low, high));
+			}
+			total = _mm256_add_epi64(total, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+		}
+
+		alignas(32) std::uint64_t lanes[4];
+		_mm256_store_si256(reinterpret_cast<__m256i *>(lanes), total);
+		std::size_t result = std::size_t(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+		for (; i < count; ++i) result += __builtin_popcountll(data[i]);
+		return result;
+	}
+#endif
+
+	/// Count the set bits in a range of words.
+	inline std::size_t popcount(word const * data, std::size_t count) {
+#ifdef ESTD_HAVE_X86_DISPATCH
+		if (count >= 16 && cpu_has_avx2()) return popcount_avx2(data, count);
+		if (cpu_has_popcnt()) return popcount_popcnt(data, count);
+#endif
+		return popcount_scalar(data, count);
+	}
+}
+
+/// Proxy reference to a single bit in a mutable bit view or bit array.
+class bit_reference {
+	/// The word holding the bit.
+	detail::bits::word * word_;
+
+	/// The mask selecting the bit in the word.
+	detail::bits::word mask_;
+
+public:
+	constexpr bit_reference(detail::bits::word * word, std::size_t bit) : word_{word}, mask_{detail::bits::word(1) << bit} {}
+
+	/// Get the value of the bit.
+	constexpr operator bool() const { return *word_ & mask_; }
+
+	/// Set the value of the bit.
+	constexpr bit_reference const & operator=(bool value) const {
+		if (value) *word_ |= mask_;
+		else       *word_ &= ~mask_;
+		return *this;
+	}
+
+	/// Set the value of the bit from another bit.
+	constexpr bit_reference const & operator=(bit_reference const & other) const {
+		return *this = bool(other);
+	}
+
+	/// Flip the bit.
+	constexpr void flip() const { *word_ ^= mask_; }
+};
+
+/// A non-owning view on a sequence of bits packed in 64 bit words.
+/**
+ * Bit `i` is stored in bit `i % 64` of word `i / 64`, counting from the least significant bit.
+ * The view always starts at the first bit of a word.
+ * Bits in the last word past the size of the view are never modified, and are ignored when counting, searching and comparing.
+ *
+ * The Word type is `std::uint64_t const` for a read-only view (bit_view) or `std::uint64_t` for a mutable view (mut_bit_view).
+ * Like view, a mutable bit view does not own the bits, so even const member functions can modify them.
+ */
+template<typename Word>
+class basic_bit_view {
+	static_assert(std::is_same_v<std::remove_const_t<Word>, detail::bits::word>, "bit views must be made of std::uint64_t words");
+
+public:
+	using word_type       = std::remove_const_t<Word>;
+	using value_type      = bool;
+	using reference       = std::conditional_t<std::is_const_v<Word>, bool, bit_reference>;
+	using iterator        = detail::index_iterator<basic_bit_view>;
+	using const_iterator  = iterator;
+	using size_type       = std::size_t;
+
+private:
+	/// True if this is a mutable view.
+	constexpr static bool is_mutable_ = !std::is_const_v<Word>;
+
+	/// The first word of the view.
+	Word * words_;
+
+	/// The number of bits in the view.
+	std::size_t size_;
+
+	/// Combine the bits of another view into this view with a bitwise operation.
+	template<detail::bits::bit_op Op>
+	void combine(basic_bit_view<word_type const> other) const {
+		static_assert(is_mutable_, "bits can only be modified through a mutable bit view");
+		if (other.size() != size_) {
+			throw std::length_error("can not combine bit views of different sizes (" + std::to_string(size_) + " and " + std::to_string(other.size()) + ")");
+		}
+		std::size_t full = size_ / detail::bits::bits_per_word;
+		detail::bits::apply_words<Op>(words_, other.data(), full);
+		if (size_ % detail::bits::bits_per_word != 0) {
+			word_type mask = detail::bits::tail_mask(size_);
+			word_type combined = detail::bits::apply<Op>(words_[full], other.data()[full]);
+			words_[full] = (words_[full] & ~mask) | (combined & mask);
+		}
+	}
+
+	/// Get a word with the bits past the end of the view cleared.
+	word_type masked_word(std::size_t index) const {
+		word_type result = words_[index];
+		if (index + 1 == word_count()) result &= detail::bits::tail_mask(size_);
+		return result;
+	}
+
+public:
+	/// Create an empty view.
+	constexpr basic_bit_view() : words_{nullptr}, size_{0} {}
+
+	/// Create a view on a number of bits starting at the first bit of a word.
+	constexpr basic_bit_view(Word * words, std::size_t size) : words_{words}, size_{size} {}
+
+	/// Allow implicit conversion of a mutable bit view to a read-only bit view.
+	constexpr operator basic_bit_view<word_type const>() const {
+		return {words_, size_};
+	}
+
+	/// Get the number of bits in the view.
+	constexpr std::size_t size() const { return size_; }
+
+	/// Check if the view has no bits.
+	constexpr bool empty() const { return size_ == 0; }
+
+	/// Get the number of words holding the bits of the view.
+	constexpr std::size_t word_count() const { return detail::bits::word_count(size_); }
+
+	/// Get a pointer to the first word.
+	constexpr Word * data() const { return words_; }
+
+	/// Get a view on the words holding the bits, for word-level iteration.
+	/**
+	 * The last word may hold bits past the end of the view.
+	 */
+	view<Word> words() const { return {words_, word_count()}; }
+
+	/// Get a bit by index, without bounds checking.
+	reference operator[](std::size_t index) const {
+		if constexpr (is_mutable_) {
+			return {words_ + index / detail::bits::bits_per_word, index % detail::bits::bits_per_word};
+		} else {
+			return (words_[index / detail::bits::bits_per_word] >> (index % detail::bits::bits_per_word)) & 1;
+		}
+	}
+
+	/// Get a bit by index.
+	/**
+	 * \throws std::out_of_range if the index is out of bounds.
+	 */
+	bool test(std::size_t index) const {
+		if (index >= size_) throw std::out_of_range("bit index " + std::to_string(index) + " out of range for size " + std::to_string(size_));
+		return (*this)[index];
+	}
+
+	/// Set a bit by index, without bounds checking.
+	void set(std::size_t index, bool value = true) const {
+		static_assert(is_mutable_, "bits can only be modified through a mutable bit view");
+		(*this)[index] = value;
+	}
+
+	/// Clear a bit by index, without bounds checking.
+	void reset(std::size_t index) const {
+		set(index, false);
+	}
+
+	/// Flip a bit by index, without bounds checking.
+	void flip(std::size_t index) const {
+		static_assert(is_mutable_, "bits can only be modified through a mutable bit view");
+		(*this)[index].flip();
+	}
+
+	/// Set all bits to a value.
+	void fill(bool value) const {
+		fill(0, size_, value);
+	}
+
+	/// Set the bits in the range [first, last) to a value, without bounds checking.
+	void fill(std::size_t first, std::size_t last, bool value) const {
+		static_assert(is_mutable_, "bits can only be modified through a mutable bit view");
+		if (first >= last) return;
+		auto assign = [this, value] (std::size_t index, word_type mask) {
+			words_[index] = value ? words_[index] | mask : words_[index] & ~mask;
+		};
+		std::size_t first_word = first / detail::bits::bits_per_word;
+		std::size_t last_word  = (last - 1) / detail::bits::bits_per_word;
+		word_type head = ~word_type(0) << (first % detail::bits::bits_per_word);
+		word_type tail = detail::bits::tail_mask(last);
+		if (first_word == last_word) return assign(first_word, head & tail);
+		assign(first_word, head);
+		std::memset(words_ + first_word + 1, value ? 0xff : 0, (last_word - first_word - 1) * sizeof(word_type));
+		assign(last_word, tail);
+	}
+
+	/// Count the number of set bits.
+	std::size_t count() const {
+		std::size_t full = size_ / detail::bits::bits_per_word;
+		std::size_t result = detail::bits::popcount(words_, full);
+		if (full != word_count()) result += __builtin_popcountll(masked_word(full));
+		return result;
+	}
+
+	/// Find the index of the first set bit, or npos if no bit is set.
+	std::size_t find_first() const {
+		return find_next(0);
+	}
+
+	/// Find the index of the first set bit at or after a position, or npos if there is none.
+	std::size_t find_next(std::size_t position) const {
+		if (position >= size_) return npos;
+		std::size_t index = position / detail::bits::bits_per_word;
+		word_type word = masked_word(index) & (~word_type(0) << (position % detail::bits::bits_per_word));
+		while (word == 0) {
+			if (++index == word_count()) return npos;
+			word = masked_word(index);
+		}
+		return index * detail::bits::bits_per_word + __builtin_ctzll(word);
+	}
+
+	/// Keep only the bits that are also set in another view of the same size.
+	/**
+	 * \throws std::length_error if the views have different sizes.
+	 */
+	basic_bit_view const & operator&=(basic_bit_view<word_type const> other) const {
+		combine<detail::bits::bit_op::and_>(other);
+		return *this;
+	}
+
+	/// Set the bits that are set in another view of the same size.
+	/**
+	 * \throws std::length_error if the views have different sizes.
+	 */
+	basic_bit_view const & operator|=(basic_bit_view<word_type const> other) const {
+		combine<detail::bits::bit_op::or_>(other);
+		return *this;
+	}
+
+	/// Flip the bits that are set in another view of the same size.
+	/**
+	 * \throws std::length_error if the views have different sizes.
+	 */
+	basic_bit_view const & operator^=(basic_bit_view<word_type const> other) const {
+		combine<detail::bits::bit_op::xor_>(other);
+		return *this;
+	}
+
+	/// Clear the bits that are set in another view of the same size.
+	/**
+	 * \throws std::length_error if the views have different sizes.
+	 */
+	basic_bit_view const & and_not(basic_bit_view<word_type const> other) const {
+		combine<detail::bits::bit_op::and_not>(other);
+		return *this;
+	}
+
+	/// Compare two bit views for equality.
+	/**
+	 * Two bit views are equal if they have the same size and the same bits are set.
+	 */
+	bool operator==(basic_bit_view<word_type const> other) const {
+		if (size_ != other.size()) return false;
+		std::size_t full = size_ / detail::bits::bits_per_word;
+		if (full > 0 && std::memcmp(words_, other.data(), full * sizeof(word_type)) != 0) return false;
+		return full == word_count() || masked_word(full) == (other.data()[full] & detail::bits::tail_mask(size_));
+	}
+
+	/// Compare two bit views for inequality.
+	bool operator!=(basic_bit_view<word_type const> other) const {
+		return !(*this == other);
+	}
+
+	iterator begin() const { return {*this, 0}; }
+	iterator end()   const { return {*this, size_}; }
+};
+
+/// Typedef for a read-only bit view.
+using bit_view = basic_bit_view<std::uint64_t const>;
+
+/// Typedef for a mutable bit view.
+using mut_bit_view = basic_bit_view<std::uint64_t>;
+
+}
@@ -0,0 +1,157 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "./view.hpp"
+#include "../range/detail/index_iterator.hpp"
+#include "../utility/cpu_features.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace estd {
+
+/// Random access range over consecutive chunks of a view, as sub-views.
+/**
+ * Chunk `i` starts at element `i * step + min(i, extra)`, clamped to the size of the view.
+ * With an alignment, the start of each chunk except the first is moved down to the first element
+ * at or after a multiple of the alignment in memory.
+ * This keeps chunks written by different threads on different cache lines.
+ *
+ * Use chunks() or chunks_of() to create a range.
+ */
+template<typename T>
+class view_chunks {
+	/// The viewed data.
+	view<T> data_;
+
+	/// The number of chunks.
+	std::size_t count_;
+
+	/// The nominal number of elements per chunk.
+	std::size_t step_;
+
+	/// The number of leading chunks that get one extra element.
+	std::size_t extra_;
+
+	/// The alignment of chunk boundaries in bytes.
+	std::size_t align_;
+
+	/// Get the index of the first element of a chunk.
+	std::size_t boundary(std::size_t i) const {
+		if (i == 0) return 0;
+		if (i >= count_) return data_.size();
+		std::size_t element = std::min(i * step_ + std::min(i, extra_), data_.size());
+		if (align_ <= 1) return element;
+		std::uintptr_t base    = reinterpret_cast<std::uintptr_t>(data_.data());
+		std::uintptr_t address = base + element * sizeof(T);
+		std::uintptr_t aligned = address - address % align_;
+		if (aligned <= base) return 0;
+		return (aligned - base + sizeof(T) - 1) / sizeof(T);
+	}
+
+public:
+	using iterator       = detail::index_iterator<view_chunks>;
+	using const_iterator = iterator;
+
+	/// Create an empty range.
+	view_chunks() : data_{nullptr, std::size_t(0)}, count_{0}, step_{0}, extra_{0}, align_{1} {}
+
+	/// Create a range of chunks.
+	/**
+	 * \throws std::invalid_argument if the alignment is zero.
+	 */
+	view_chunks(view<T> data, std::size_t count, std::size_t step, std::size_t extra, std::size_t align_bytes) :
+		data_{data}, count_{count}, step_{step}, extra_{extra}, align_{align_bytes}
+	{
+		if (align_bytes == 0) throw std::invalid_argument("chunk alignment must not be zero");
+	}
+
+	/// Get the number of chunks.
+	std::size_t size() const { return count_; }
+
+	/// Check if there are no chunks.
+	bool empty() const { return count_ == 0; }
+
+	/// Get a chunk by index, without bounds checking.
+	view<T> operator[](std::size_t i) const {
+		return {data_.data() + boundary(i), data_.data() + boundary(i + 1)};
+	}
+
+	/// Get a chunk by index.
+	/**
+	 * \throws std::out_of_range if the index is out of range.
+	 */
+	view<T> at(std::size_t i) const {
+		if (i >= count_) throw std::out_of_range("chunk index " + std::to_string(i) + " out of range for " + std::to_string(count_) + " chunks");
+		return (*this)[i];
+	}
+
+	iterator begin() const { return {*this, 0}; }
+	iterator end()   const { return {*this, size()}; }
+};
+
+/// Split a view in a number of chunks of approximately equal size.
+/**
+ * The first `data.size() % n_chunks` chunks get one element more than the others.
+ * Without alignment, chunks differ in size by at most one element.
+ *
+ * With an alignment (for example cache_line_size), the boundaries between chunks are moved down to the alignment in memory,
+ * so that no two chunks share a cache line (except for elements straddling an aligned address).
+ * Note that the boundaries then depend on the address of the data, not only on its size,
+ * and that chunks can be empty if they are smaller than the alignment.
+ *
+ * The returned range is random access, so a thread pool can look up chunk `i` directly.
+ */
+template<typename T>
+view_chunks<T> chunks(view<T> data, std::size_t n_chunks, std::size_t align_bytes = 1) {
+	if (n_chunks == 0) return {data, 0, 0, 0, align_bytes};
+	return {data, n_chunks, data.size() / n_chunks, data.size() % n_chunks, align_bytes};
+}
+
+/// Split a view in chunks of a fixed number of elements.
+/**
+ * The last chunk holds the remaining elements and may be shorter.
+ *
+ * With an alignment, the boundaries between chunks are moved down to the alignment in memory, see chunks().
+ * Choose a chunk size that is a multiple of the alignment to keep the chunks of equal size
+ * (apart from the first and last chunk) when the data itself is not aligned.
+ *
+ * \throws std::invalid_argument if the chunk size is zero.
+ */
+template<typename T>
+view_chunks<T> chunks_of(view<T> data, std::size_t chunk_size, std::size_t align_bytes = 1) {
+	if (chunk_size == 0) throw std::invalid_argument("chunk size must not be zero");
+	return {data, data.size() / chunk_size + (data.size() % chunk_size != 0), chunk_size, 0, align_bytes};
+}
+
+}
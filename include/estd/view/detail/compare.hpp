@@ -0,0 +1,166 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "../../utility/cpu_features.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(ESTD_HAVE_X86_DISPATCH)
+#  include <immintrin.h>
+#endif
+
+namespace estd {
+namespace detail::compare {
+	/// True if elements of a type are equal exactly when their bytes are equal.
+	/**
+	 * Only built-in types qualify, since class types may define their own comparison operators.
+	 */
+	template<typename T>
+	constexpr bool is_bitwise_comparable = std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+	/// True if lexicographic ordering of a type equals the ordering of its bytes with memcmp.
+	template<typename T>
+	constexpr bool is_memcmp_orderable = sizeof(T) == 1 && (std::is_unsigned_v<T> || std::is_same_v<T, std::byte>);
+
+	constexpr std::size_t none = std::size_t(-1);
+
+	// When the kernels below are inlined into a caller that compares small arrays,
+	// GCC can not prove that the block loads stay within the arrays and warns with -Warray-bounds.
+	// The loads only run on whole blocks within `size`, so silence the warning here instead of preventing inlining.
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+	/// Find the index of the first differing byte, or none.
+	inline std::size_t first_difference_scalar(std::uint8_t const * a, std::uint8_t const * b, std::size_t size) {
+		std::size_t const block_end = size & ~std::size_t(7);
+		std::size_t i = 0;
+		for (; i < block_end; i += 8) {
+			std::uint64_t word_a;
+			std::uint64_t word_b;
+			std::memcpy(&word_a, a + i, 8);
+			std::memcpy(&word_b, b + i, 8);
+			if (word_a != word_b) break;
+		}
+		for (; i < size; ++i) {
+			if (a[i] != b[i]) return i;
+		}
+		return none;
+	}
+
+#if defined(__SSE2__)
+	inline std::size_t first_difference_sse2(std::uint8_t const * a, std::uint8_t const * b, std::size_t size) {
+		std::size_t const block_end = size & ~std::size_t(15);
+		std::size_t i = 0;
+		for (; i < block_end; i += 16) {
+			__m128i block_a = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a + i));
+			__m128i block_b = _mm_loadu_si128(reinterpret_cast<__m128i const *>(b + i));
+			unsigned int mask = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(block_a, block_b))) ^ 0xffffu;
+			if (mask) return i + __builtin_ctz(mask);
+		}
+		std::size_t rest = first_difference_scalar(a + i, b + i, size - i);
+		return rest == none ? none : i + rest;
+	}
+#endif
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+	ESTD_TARGET("avx2") inline std::size_t first_difference_avx2(std::uint8_t const * a, std::uint8_t const * b, std::size_t size) {
+		std::size_t const block_end = size & ~std::size_t(31);
+		std::size_t i = 0;
+		for (; i < block_end; i += 32) {
+			__m256i block_a = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(a + i));
+			__m256i block_b = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(b + i));
+			std::uint32_t mask = ~std::uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block_a, block_b)));
+			if (mask) return i + __builtin_ctz(mask);
+		}
+		std::size_t rest = first_difference_scalar(a + i, b + i, size - i);
+		return rest == none ? none : i + rest;
+	}
+#endif
+
+	/// Find the index of the first differing byte of two buffers of equal size, or none.
+	inline std::size_t first_difference(void const * a, void const * b, std::size_t size) {
+		auto bytes_a = static_cast<std::uint8_t const *>(a);
+		auto bytes_b = static_cast<std::uint8_t const *>(b);
+#ifdef ESTD_HAVE_X86_DISPATCH
+		if (cpu_has_avx2()) return first_difference_avx2(bytes_a, bytes_b, size);
+#endif
+#if defined(__SSE2__)
+		return first_difference_sse2(bytes_a, bytes_b, size);
+#else
+		return first_difference_scalar(bytes_a, bytes_b, size);
+#endif
+	}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic pop
+#endif
+
+	/// Check if two ranges of the same size have equal elements.
+	template<typename T>
+	bool equal(T const * a, T const * b, std::size_t size) {
+		if constexpr (is_bitwise_comparable<T>) {
+			return a == b || size == 0 || std::memcmp(a, b, size * sizeof(T)) == 0;
+		} else {
+			return std::equal(a, a + size, b);
+		}
+	}
+
+	/// Compare two ranges lexicographically.
+	/**
+	 * \return A negative value if a sorts before b, zero if they are equal, and a positive value if a sorts after b.
+	 */
+	template<typename T>
+	int lexicographic(T const * a, std::size_t size_a, T const * b, std::size_t size_b) {
+		std::size_t size = std::min(size_a, size_b);
+		if constexpr (is_memcmp_orderable<T>) {
+			int result = size == 0 ? 0 : std::memcmp(a, b, size);
+			if (result != 0) return result;
+		} else if constexpr (is_bitwise_comparable<T>) {
+			std::size_t difference = first_difference(a, b, size * sizeof(T));
+			if (difference != none) {
+				std::size_t i = difference / sizeof(T);
+				return a[i] < b[i] ? -1 : 1;
+			}
+		} else {
+			for (std::size_t i = 0; i < size; ++i) {
+				if (a[i] < b[i]) return -1;
+				if (b[i] < a[i]) return 1;
+			}
+		}
+		if (size_a == size_b) return 0;
+		return size_a < size_b ? -1 : 1;
+	}
+}}
@@ -0,0 +1,278 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include "./view.hpp"
+#include "../range/detail/index_iterator.hpp"
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace estd {
+
+template<typename T, std::size_t Rank> class nd_view;
+
+/// Random access range over the innermost rows of an nd_view, as contiguous views.
+template<typename T, std::size_t Rank>
+class nd_rows {
+	/// The viewed data.
+	nd_view<T, Rank> data_;
+
+public:
+	using iterator       = detail::index_iterator<nd_rows>;
+	using const_iterator = iterator;
+
+	nd_rows() = default;
+	explicit nd_rows(nd_view<T, Rank> data) : data_{data} {}
+
+	/// Get the number of rows.
+	std::size_t size() const { return data_.row_count(); }
+
+	/// Check if there are no rows.
+	bool empty() const { return size() == 0; }
+
+	/// Get a row by index, without bounds checking.
+	view<T> operator[](std::size_t i) const { return data_.row(i); }
+
+	iterator begin() const { return {*this, 0}; }
+	iterator end()   const { return {*this, size()}; }
+};
+
+/// A non-owning view on a multi-dimensional array of elements.
+/**
+ * The view has a runtime extent and stride for each dimension.
+ * Strides are in elements, not bytes.
+ * The default strides describe a row-major (C order) contiguous array, where the last index varies fastest.
+ *
+ * Sub-views (for example a region of interest in an image) share the data of the original view,
+ * but they are in general not contiguous anymore.
+ */
+template<typename T, std::size_t Rank>
+class nd_view {
+	static_assert(Rank > 0, "nd_view must have at least one dimension");
+
+public:
+	using value_type = T;
+	using reference  = T &;
+	using size_type  = std::size_t;
+	using index_type = std::array<std::size_t, Rank>;
+
+	/// The number of dimensions.
+	static constexpr std::size_t rank = Rank;
+
+private:
+	/// Pointer to the element with all indices zero.
+	T * data_;
+
+	/// The extent of each dimension.
+	index_type extents_;
+
+	/// The stride of each dimension in elements.
+	index_type strides_;
+
+	/// Get the strides of a contiguous row-major array.
+	static index_type contiguous_strides(index_type const & extents) {
+		index_type strides;
+		std::size_t stride = 1;
+		for (std::size_t i = Rank; i-- > 0;) {
+			strides[i] = stride;
+			stride *= extents[i];
+		}
+		return strides;
+	}
+
+	/// Get the total number of elements for a set of extents.
+	static std::size_t product(index_type const & extents) {
+		std::size_t result = 1;
+		for (std::size_t extent : extents) result *= extent;
+		return result;
+	}
+
+public:
+	/// Create an empty view.
+	constexpr nd_view() : data_{nullptr}, extents_{}, strides_{} {}
+
+	/// Create a view of contiguous row-major data.
+	nd_view(T * data, index_type const & extents) : data_{data}, extents_{extents}, strides_{contiguous_strides(extents)} {}
+
+	/// Create a view with explicit strides.
+	constexpr nd_view(T * data, index_type const & extents, index_type const & strides) : data_{data}, extents_{extents}, strides_{strides} {}
+
+	/// Create a view of contiguous row-major data from a flat view.
+	/**
+	 * \throws std::invalid_argument if the size of the flat view does not match the extents.
+	 */
+	nd_view(view<T> data, index_type const & extents) : nd_view(data.data(), extents) {
+		if (data.size() != size()) {
+			throw std::invalid_argument("view of " + std::to_string(data.size()) + " elements does not match nd_view extents with " + std::to_string(size()) + " elements");
+		}
+	}
+
+	/// Allow implicit conversion of a nd_view<T> to a nd_view<T const>.
+	constexpr operator nd_view<T const, Rank>() const {
+		return {data_, extents_, strides_};
+	}
+
+	/// Get a pointer to the element with all indices zero.
+	constexpr T * data() const { return data_; }
+
+	/// Get the extents of all dimensions.
+	constexpr index_type const & extents() const { return extents_; }
+
+	/// Get the extent of a dimension.
+	constexpr std::size_t extent(std::size_t dimension) const { return extents_[dimension]; }
+
+	/// Get the strides in elements of all dimensions.
+	constexpr index_type const & strides() const { return strides_; }
+
+	/// Get the stride in elements of a dimension.
+	constexpr std::size_t stride(std::size_t dimension) const { return strides_[dimension]; }
+
+	/// Get the total number of elements in the view.
+	std::size_t size() const { return product(extents_); }
+
+	/// Check if the view has no elements.
+	bool empty() const { return size() == 0; }
+
+	/// Check if the view describes a contiguous row-major array.
+	/**
+	 * Dimensions with an extent of 1 are ignored, since their stride does not matter.
+	 */
+	bool is_contiguous() const {
+		std::size_t expected = 1;
+		for (std::size_t i = Rank; i-- > 0;) {
+			if (extents_[i] != 1 && strides_[i] != expected) return false;
+			expected *= extents_[i];
+		}
+		return true;
+	}
+
+	/// Get a reference to an element by index, without bounds checking.
+	template<typename... Indices, typename = std::enable_if_t<sizeof...(Indices) == Rank>>
+	constexpr T & operator() (Indices... indices) const {
+		index_type index{{std::size_t(indices)...}};
+		std::size_t offset = 0;
+		for (std::size_t i = 0; i < Rank; ++i) offset += index[i] * strides_[i];
+		return data_[offset];
+	}
+
+	/// Get a reference to an element by index, with bounds checking.
+	/**
+	 * \throws std::range_error if an index is out of bounds.
+	 */
+	T & at(index_type const & index) const {
+		std::size_t offset = 0;
+		for (std::size_t i = 0; i < Rank; ++i) {
+			if (index[i] >= extents_[i]) throw std::range_error("index " + std::to_string(index[i]) + " out of range for dimension " + std::to_string(i) + " with extent " + std::to_string(extents_[i]));
+			offset += index[i] * strides_[i];
+		}
+		return data_[offset];
+	}
+
+	/// Get a sub-view of the view, sharing the same data.
+	/**
+	 * \throws std::range_error if the sub-view is out of bounds.
+	 */
+	nd_view subview(index_type const & offset, index_type const & extents) const {
+		std::size_t data_offset = 0;
+		for (std::size_t i = 0; i < Rank; ++i) {
+			if (offset[i] > extents_[i] || extents[i] > extents_[i] - offset[i]) {
+				throw std::range_error("subview [" + std::to_string(offset[i]) + ", " + std::to_string(offset[i] + extents[i]) + ") out of range for dimension " + std::to_string(i) + " with extent " + std::to_string(extents_[i]));
+			}
+			data_offset += offset[i] * strides_[i];
+		}
+		return {data_ + data_offset, extents, strides_};
+	}
+
+	/// Index the first dimension.
+	/**
+	 * For views with more than one dimension, this gives a view with one dimension less.
+	 * For one-dimensional views, this gives a reference to an element.
+	 * No bounds checking is performed.
+	 */
+	constexpr decltype(auto) operator[] (std::size_t i) const {
+		if constexpr (Rank == 1) {
+			return data_[i * strides_[0]];
+		} else {
+			std::array<std::size_t, Rank - 1> extents;
+			std::array<std::size_t, Rank - 1> strides;
+			for (std::size_t d = 1; d < Rank; ++d) {
+				extents[d - 1] = extents_[d];
+				strides[d - 1] = strides_[d];
+			}
+			return nd_view<T, Rank - 1>{data_ + i * strides_[0], extents, strides};
+		}
+	}
+
+	/// Get the data as flat view.
+	/**
+	 * \throws std::logic_error if the view is not contiguous.
+	 */
+	view<T> flat() const {
+		if (!is_contiguous()) throw std::logic_error("attempted to get flat view of non-contiguous nd_view");
+		return {data_, size()};
+	}
+
+	/// Get the number of innermost rows.
+	std::size_t row_count() const {
+		std::size_t result = 1;
+		for (std::size_t i = 0; i + 1 < Rank; ++i) result *= extents_[i];
+		return result;
+	}
+
+	/// Get an innermost row by linear index as contiguous view, without bounds checking.
+	/**
+	 * Rows are numbered in row-major order of the outer indices.
+	 * The innermost dimension must have a stride of 1, which is checked by rows().
+	 */
+	view<T> row(std::size_t index) const {
+		std::size_t offset = 0;
+		for (std::size_t i = Rank - 1; i-- > 0;) {
+			offset += index % extents_[i] * strides_[i];
+			index  /= extents_[i];
+		}
+		return {data_ + offset, extents_[Rank - 1]};
+	}
+
+	/// Get a random access range over all innermost rows as contiguous views.
+	/**
+	 * Even if the view as a whole is not contiguous (for example, a region of interest),
+	 * the rows often are, which allows processing them with fast contiguous kernels.
+	 *
+	 * \throws std::logic_error if the innermost dimension is not contiguous.
+	 */
+	nd_rows<T, Rank> rows() const {
+		if (extents_[Rank - 1] > 1 && strides_[Rank - 1] != 1) throw std::logic_error("attempted to iterate rows of nd_view with non-contiguous innermost dimension");
+		return nd_rows<T, Rank>{*this};
+	}
+};
+
+}
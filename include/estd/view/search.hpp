@@ -0,0 +1,318 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "./view.hpp"
+#include "../utility/cpu_features.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(ESTD_HAVE_X86_DISPATCH)
+#  include <immintrin.h>
+#endif
+
+namespace estd {
+
+namespace detail::search {
+	/// Add an offset to a search result, preserving npos.
+	inline std::size_t offset_result(std::size_t offset, std::size_t result) {
+		return result == npos ? npos : offset + result;
+	}
+
+	inline std::size_t find_scalar(std::uint8_t const * data, std::size_t size, std::uint8_t needle) {
+		if (size == 0) return npos;
+		void const * found = std::memchr(data, needle, size);
+		return found ? static_cast<std::uint8_t const *>(found) - data : npos;
+	}
+
+	inline std::size_t count_scalar(std::uint8_t const * data, std::size_t size, std::uint8_t needle) {
+		return std::count(data, data + size, needle);
+	}
+
+	inline std::size_t find_any_scalar(std::uint8_t const * data, std::size_t size, std::uint8_t const * set, std::size_t set_size) {
+		bool table[256] = {};
+		for (std::size_t i = 0; i < set_size; ++i) table[set[i]] = true;
+		for (std::size_t i = 0; i < size; ++i) {
+			if (table[data[i]]) return i;
+		}
+		return npos;
+	}
+
+	/// Find a needle of at least one byte by scanning for the first byte and comparing the rest.
+	inline std::size_t find_subsequence_scalar(std::uint8_t const * data, std::size_t size, std::uint8_t const * needle, std::size_t needle_size) {
+		std::size_t i = 0;
+		while (size - i >= needle_size) {
+			void const * found = std::memchr(data + i, needle[0], size - i - needle_size + 1);
+			if (!found) return npos;
+			std::size_t position = static_cast<std::uint8_t const *>(found) - data;
+			if (std::memcmp(data + position + 1, needle + 1, needle_size - 1) == 0) return position;
+			i = position + 1;
+		}
+		return npos;
+	}
+
+#if defined(__SSE2__)
+	/// Maximum set size for the SSE2 find_any kernel, which compares against every byte of the set.
+	constexpr std::size_t find_any_sse2_max_set = 16;
+
+	inline std::size_t find_sse2(std::uint8_t const * data, std::size_t size, std::uint8_t needle) {
+		__m128i const pattern = _mm_set1_epi8(char(needle));
+		std::size_t i = 0;
+		for (; i + 16 <= size; i += 16) {
+			__m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + i));
+			unsigned int mask = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern)));
+			if (mask) return i + __builtin_ctz(mask);
+		}
+		return offset_result(i, find_scalar(data + i, size - i, needle));
+	}
+
+	inline std::size_t count_sse2(std::uint8_t const * data, std::size_t size, std::uint8_t needle) {
+		__m128i const pattern = _mm_set1_epi8(char(needle));
+		__m128i const zero    = _mm_setzero_si128();
+		__m128i total = zero;
+		std::size_t i = 0;
+		while (size - i >= 16) {
+			// Each byte lane of the partial sum can count at most 255 matches.
+			std::size_t end = i + std::min<std::size_t>((size - i) / 16, 255) * 16;
+			__m128i partial = zero;
+			for (; i < end; i += 16) {
+				__m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + i));
+				partial = _mm_sub_epi8(partial, _mm_cmpeq_epi8(block, pattern));
+			}
+			total = _mm_add_epi64(total, _mm_sad_epu8(partial, zero));
+		}
+		alignas(16) std::uint64_t lanes[2];
+		_mm_store_si128(reinterpret_cast<__m128i *>(lanes), total);
+		return lanes[0] + lanes[1] + count_scalar(data + i, size - i, needle);
+	}
+
+	inline std::size_t find_any_sse2(std::uint8_t const * data, std::size_t size, std::uint8_t const * set, std::size_t set_size) {
+		__m128i patterns[find_any_sse2_max_set];
+		for (std::size_t k = 0; k < set_size; ++k) patterns[k] = _mm_set1_epi8(char(set[k]));
+		std::size_t i = 0;
+		for (; i + 16 <= size; i += 16) {
+			__m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + i));
+			__m128i match = _mm_cmpeq_epi8(block, patterns[0]);
+			for (std::size_t k = 1; k < set_size; ++k) match = _mm_or_si128(match, _mm_cmpeq_epi8(block, patterns[k]));
+			unsigned int mask = unsigned(_mm_movemask_epi8(match));
+			if (mask) return i + __builtin_ctz(mask);
+		}
+		return offset_result(i, find_any_scalar(data + i, size - i, set, set_size));
+	}
+
+	/// Find a needle of at least two bytes by matching the first and last byte of every candidate in parallel.
+	inline std::size_t find_subsequence_sse2(std::uint8_t const * data, std::size_t size, std::uint8_t const * needle, std::size_t needle_size) {
+		__m128i const first = _mm_set1_epi8(char(needle[0]));
+		__m128i const last  = _mm_set1_epi8(char(needle[needle_size - 1]));
+		std::size_t i = 0;
+		for (; size - i >= needle_size - 1 + 16; i += 16) {
+			__m128i block_first = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + i));
+			__m128i block_last  = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + i + needle_size - 1));
+			unsigned int mask = unsigned(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last))));
+			while (mask) {
+				std::size_t position = i + __builtin_ctz(mask);
+				if (std::memcmp(data + position + 1, needle + 1, needle_size - 2) == 0) return position;
+				mask &= mask - 1;
+			}
+		}
+		return offset_result(i, find_subsequence_scalar(data + i, size - i, needle, needle_size));
+	}
+#endif
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+	ESTD_TARGET("avx2") inline std::size_t find_avx2(std::uint8_t const * data, std::size_t size, std::uint8_t needle) {
+		__m256i const pattern = _mm256_set1_epi8(char(needle));
+		std::size_t i = 0;
+		for (; i + 64 <= size; i += 64) {
+			__m256i match_a = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + i)), pattern);
+			__m256i match_b = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + i + 32)), pattern);
+			if (!_mm256_testz_si256(_mm256_or_si256(match_a, match_b), _mm256_or_si256(match_a, match_b))) {
+				std::uint64_t mask = std::uint32_t(_mm256_movemask_epi8(match_a)) | std::uint64_t(std::uint32_t(_mm256_movemask_epi8(match_b))) << 32;
+				return i + __builtin_ctzll(mask);
+			}
+		}
+		for (; i + 32 <= size; i += 32) {
+			__m256i block = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + i));
+			unsigned int mask = unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, pattern)));
+			if (mask) return i + __builtin_ctz(mask);
+		}
+		return offset_result(i, find_scalar(data + i, size - i, needle));
+	}
+
+	ESTD_TARGET("avx2") inline std::size_t count_avx2(std::uint8_t const * data, std::size_t size, std::uint8_t needle) {
+		__m256i const pattern = _mm256_set1_epi8(char(needle));
+		__m256i const zero    = _mm256_setzero_si256();
+		__m256i total = zero;
+		std::size_t i = 0;
+		while (size - i >= 32) {
+			// Each byte lane of the partial sum can count at most 255 matches.
+			std::size_t end = i + std::min<std::size_t>((size - i) / 32, 255) * 32;
+			__m256i partial = zero;
+			for (; i < end; i += 32) {
+				__m256i block = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + i));
+				partial = _mm256_sub_epi8(partial, _mm256_cmpeq_epi8(block, pattern));
+			}
+			total = _mm256_add_epi64(total, _mm256_sad_epu8(partial, zero));
+		}
+		alignas(32) std::uint64_t lanes[4];
+		_mm256_store_si256(reinterpret_cast<__m256i *>(lanes), total);
+		return lanes[0] + lanes[1] + lanes[2] + lanes[3] + count_scalar(data + i, size - i, needle);
+	}
+
+	/// Find any byte from a set of arbitrary size using a 256 bit membership bitmap split by nibble.
+	/**
+	 * Row tables indexed by the low nibble hold one bit per high nibble.
+	 * Two tables are needed because a byte only holds eight bits.
+	 */
+	ESTD_TARGET("avx2") inline std::size_t find_any_avx2(std::uint8_t const * data, std::size_t size, std::uint8_t const * set, std::size_t set_size) {
+		alignas(16) std::uint8_t rows_low[16]  = {};
+		alignas(16) std::uint8_t rows_high[16] = {};
+		for (std::size_t k = 0; k < set_size; ++k) {
+			std::uint8_t high = set[k] >> 4;
+			std::uint8_t low  = set[k] & 0x0f;
+			if (high < 8) rows_low[low]  |= std::uint8_t(1u << high);
+			else          rows_high[low] |= std::uint8_t(1u << (high - 8));
+		}
+
+		__m256i const table_low  = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<__m128i const *>(rows_low)));
+		__m256i const table_high = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<__m128i const *>(rows_high)));
+		__m256i const bits       = _mm256_setr_epi8(
+			1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+			1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128
+		);
+		__m256i const nibble     = _mm256_set1_epi8(0x0f);
+		__m256i const seven      = _mm256_set1_epi8(7);
+
+		std::size_t i = 0;
+		for (; i + 32 <= size; i += 32) {
+			__m256i block = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + i));
+			__m256i low   = _mm256_and_si256(block, nibble);
+			__m256i high  = _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble);
+			__m256i row   = _mm256_blendv_epi8(_mm256_shuffle_epi8(table_low, low), _mm256_shuffle_epi8(table_high, low), _mm256_cmpgt_epi8(high, seven));
+			__m256i bit   = _mm256_shuffle_epi8(bits, high);
+			unsigned int mask = unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit)));
+			if (mask) return i + __builtin_ctz(mask);
+		}
+		return offset_result(i, find_any_scalar(data + i, size - i, set, set_size));
+	}
+
+	/// Find a needle of at least two bytes by matching the first and last byte of every candidate in parallel.
+	ESTD_TARGET("avx2") inline std::size_t find_subsequence_avx2(std::uint8_t const * data, std::size_t size, std::uint8_t const * needle, std::size_t needle_size) {
+		__m256i const first = _mm256_set1_epi8(char(needle[0]));
+		__m256i const last  = _mm256_set1_epi8(char(needle[needle_size - 1]));
+		std::size_t i = 0;
+		for (; size - i >= needle_size - 1 + 32; i += 32) {
+			__m256i block_first = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + i));
+			__m256i block_last  = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + i + needle_size - 1));
+			unsigned int mask = unsigned(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(block_first, first), _mm256_cmpeq_epi8(block_last, last))));
+			while (mask) {
+				std::size_t position = i + __builtin_ctz(mask);
+				if (std::memcmp(data + position + 1, needle + 1, needle_size - 2) == 0) return position;
+				mask &= mask - 1;
+			}
+		}
+		return offset_result(i, find_subsequence_scalar(data + i, size - i, needle, needle_size));
+	}
+#endif
+}
+
+/// Find the first occurrence of a byte.
+/**
+ * Uses AVX2 if the CPU supports it, SSE2 if the build targets it, and a scalar fallback otherwise.
+ *
+ * \return The index of the first occurrence, or npos if the byte was not found.
+ */
+inline std::size_t find(byte_view haystack, std::uint8_t needle) {
+#ifdef ESTD_HAVE_X86_DISPATCH
+	if (cpu_has_avx2()) return detail::search::find_avx2(haystack.data(), haystack.size(), needle);
+#endif
+#if defined(__SSE2__)
+	return detail::search::find_sse2(haystack.data(), haystack.size(), needle);
+#else
+	return detail::search::find_scalar(haystack.data(), haystack.size(), needle);
+#endif
+}
+
+/// Find the first occurrence of a byte from a set.
+/**
+ * The AVX2 kernel handles sets of any size.
+ * The SSE2 kernel handles sets of up to 16 bytes, larger sets use a scalar lookup table.
+ *
+ * \return The index of the first byte that is in the set, or npos if there is none.
+ */
+inline std::size_t find_any(byte_view haystack, byte_view set) {
+	if (set.size() == 0) return npos;
+	if (set.size() == 1) return find(haystack, set[0]);
+#ifdef ESTD_HAVE_X86_DISPATCH
+	if (cpu_has_avx2()) return detail::search::find_any_avx2(haystack.data(), haystack.size(), set.data(), set.size());
+#endif
+#if defined(__SSE2__)
+	if (set.size() <= detail::search::find_any_sse2_max_set) {
+		return detail::search::find_any_sse2(haystack.data(), haystack.size(), set.data(), set.size());
+	}
+#endif
+	return detail::search::find_any_scalar(haystack.data(), haystack.size(), set.data(), set.size());
+}
+
+/// Find the first occurrence of a byte sequence.
+/**
+ * An empty needle is found at index 0.
+ *
+ * \return The index of the start of the first occurrence, or npos if the sequence was not found.
+ */
+inline std::size_t find(byte_view haystack, byte_view needle) {
+	if (needle.size() == 0) return 0;
+	if (needle.size() > haystack.size()) return npos;
+	if (needle.size() == 1) return find(haystack, needle[0]);
+#ifdef ESTD_HAVE_X86_DISPATCH
+	if (cpu_has_avx2()) return detail::search::find_subsequence_avx2(haystack.data(), haystack.size(), needle.data(), needle.size());
+#endif
+#if defined(__SSE2__)
+	return detail::search::find_subsequence_sse2(haystack.data(), haystack.size(), needle.data(), needle.size());
+#else
+	return detail::search::find_subsequence_scalar(haystack.data(), haystack.size(), needle.data(), needle.size());
+#endif
+}
+
+/// Count the number of occurrences of a byte.
+inline std::size_t count(byte_view haystack, std::uint8_t needle) {
+#ifdef ESTD_HAVE_X86_DISPATCH
+	if (cpu_has_avx2()) return detail::search::count_avx2(haystack.data(), haystack.size(), needle);
+#endif
+#if defined(__SSE2__)
+	return detail::search::count_sse2(haystack.data(), haystack.size(), needle);
+#else
+	return detail::search::count_scalar(haystack.data(), haystack.size(), needle);
+#endif
+}
+
+}
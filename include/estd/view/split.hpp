@@ -0,0 +1,217 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "./search.hpp"
+#include "./view.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+namespace estd {
+
+/// Forward iterator over the pieces of a split view or string.
+/**
+ * The iterator holds everything it needs by value, except the data and a multi element delimiter,
+ * so it stays valid when the split range it came from is destroyed.
+ */
+template<typename Piece>
+class split_iterator {
+public:
+	using value_type        = Piece;
+	using difference_type   = std::ptrdiff_t;
+	using reference         = Piece const &;
+	using pointer           = Piece const *;
+	using iterator_category = std::forward_iterator_tag;
+
+private:
+	using element_pointer = decltype(std::declval<Piece const &>().data());
+	using element_type    = std::remove_const_t<std::remove_pointer_t<element_pointer>>;
+
+	/// The current piece.
+	Piece piece_{element_pointer(nullptr), std::size_t(0)};
+
+	/// The start of the data after the delimiter that ended the current piece, or null if the current piece is the last.
+	element_pointer rest_ = nullptr;
+
+	/// The end of the data.
+	element_pointer end_ = nullptr;
+
+	/// The delimiter, if it is longer than one element.
+	element_type const * delimiter_ = nullptr;
+
+	/// The size of the delimiter.
+	std::size_t delimiter_size_ = 0;
+
+	/// The delimiter, if it is a single element.
+	element_type single_{};
+
+	/// True if the iterator is past the last piece.
+	bool finished_ = true;
+
+	/// Find the next delimiter in the data, returning its index or npos.
+	std::size_t locate(element_pointer data, std::size_t size) const {
+		if constexpr (sizeof(element_type) == 1 && std::is_trivially_copyable_v<element_type>) {
+			byte_view haystack{reinterpret_cast<std::uint8_t const *>(data), size};
+			if (delimiter_size_ == 1) {
+				std::uint8_t needle;
+				std::memcpy(&needle, &single_, 1);
+				return find(haystack, needle);
+			}
+			return find(haystack, byte_view{reinterpret_cast<std::uint8_t const *>(delimiter_), delimiter_size_});
+		} else {
+			element_pointer found = delimiter_size_ == 1
+				? std::find(data, data + size, single_)
+				: std::search(data, data + size, delimiter_, delimiter_ + delimiter_size_);
+			return found == data + size ? npos : std::size_t(found - data);
+		}
+	}
+
+	/// Make the piece starting at `begin` the current piece.
+	void load(element_pointer begin) {
+		std::size_t size  = end_ - begin;
+		std::size_t found = locate(begin, size);
+		if (found == npos) {
+			piece_ = Piece(begin, size);
+			rest_  = nullptr;
+		} else {
+			piece_ = Piece(begin, found);
+			rest_  = begin + found + delimiter_size_;
+		}
+	}
+
+public:
+	/// Create an end iterator.
+	split_iterator() = default;
+
+	/// Create an iterator to the first piece of data split by a single element.
+	split_iterator(element_pointer begin, element_pointer end, element_type delimiter) :
+		end_{end}, delimiter_size_{1}, single_{delimiter}, finished_{false}
+	{
+		load(begin);
+	}
+
+	/// Create an iterator to the first piece of data split by a sequence of elements.
+	/**
+	 * The delimiter must outlive the iterator.
+	 */
+	split_iterator(element_pointer begin, element_pointer end, element_type const * delimiter, std::size_t delimiter_size) :
+		end_{end}, delimiter_{delimiter}, delimiter_size_{delimiter_size}, finished_{false}
+	{
+		if (delimiter_size == 1) single_ = delimiter[0];
+		load(begin);
+	}
+
+	Piece const & operator*() const { return piece_; }
+	Piece const * operator->() const { return &piece_; }
+
+	split_iterator & operator++() {
+		if (rest_) load(rest_);
+		else finished_ = true;
+		return *this;
+	}
+
+	split_iterator operator++(int) {
+		split_iterator old = *this;
+		++*this;
+		return old;
+	}
+
+	bool operator==(split_iterator const & other) const {
+		if (finished_ || other.finished_) return finished_ == other.finished_;
+		return piece_.data() == other.piece_.data() && rest_ == other.rest_;
+	}
+
+	bool operator!=(split_iterator const & other) const {
+		return !(*this == other);
+	}
+};
+
+/// Lazy range of the pieces of a view or string, separated by a delimiter.
+/**
+ * Pieces are views on the original data, nothing is copied or allocated.
+ * Adjacent delimiters produce empty pieces, and splitting empty data produces one empty piece.
+ */
+template<typename Piece>
+class split_range {
+public:
+	using iterator       = split_iterator<Piece>;
+	using const_iterator = split_iterator<Piece>;
+	using value_type     = Piece;
+
+private:
+	iterator begin_;
+
+public:
+	explicit split_range(iterator begin) : begin_{begin} {}
+
+	iterator begin() const { return begin_; }
+	iterator end() const { return {}; }
+};
+
+/// Split a view on a single element.
+template<typename T>
+split_range<view<T>> split(view<T> input, std::remove_const_t<T> delimiter) {
+	return split_range<view<T>>{{input.begin(), input.end(), delimiter}};
+}
+
+/// Split a view on a sequence of elements.
+/**
+ * The delimiter must outlive the range and its iterators.
+ *
+ * \throws std::invalid_argument if the delimiter is empty.
+ */
+template<typename T>
+split_range<view<T>> split(view<T> input, view<std::remove_const_t<T> const> delimiter) {
+	if (delimiter.size() == 0) throw std::invalid_argument("split delimiter can not be empty");
+	return split_range<view<T>>{{input.begin(), input.end(), delimiter.data(), delimiter.size()}};
+}
+
+/// Split a string on a single character.
+inline split_range<std::string_view> split(std::string_view input, char delimiter) {
+	return split_range<std::string_view>{{input.data(), input.data() + input.size(), delimiter}};
+}
+
+/// Split a string on a sequence of characters.
+/**
+ * The delimiter must outlive the range and its iterators.
+ *
+ * \throws std::invalid_argument if the delimiter is empty.
+ */
+inline split_range<std::string_view> split(std::string_view input, std::string_view delimiter) {
+	if (delimiter.size() == 0) throw std::invalid_argument("split delimiter can not be empty");
+	return split_range<std::string_view>{{input.data(), input.data() + input.size(), delimiter.data(), delimiter.size()}};
+}
+
+}
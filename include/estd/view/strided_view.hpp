@@ -0,0 +1,230 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include "./view.hpp"
+#include "../utility/cpu_features.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+#  include <immintrin.h>
+#endif
+
+namespace estd {
+
+/// Random access iterator over elements with a fixed stride.
+/**
+ * The iterator holds a pointer to the first element of the view and an index,
+ * so that the end iterator does not have to form a pointer far past the end of the viewed array.
+ * Only iterators of the same view can be compared.
+ */
+template<typename T>
+class strided_iterator {
+public:
+	using value_type        = std::remove_const_t<T>;
+	using difference_type   = std::ptrdiff_t;
+	using reference         = T &;
+	using pointer           = T *;
+	using iterator_category = std::random_access_iterator_tag;
+
+private:
+	T * data_;
+	difference_type index_;
+	difference_type stride_;
+
+public:
+	constexpr strided_iterator() : data_{nullptr}, index_{0}, stride_{1} {}
+	constexpr strided_iterator(T * data, difference_type index, difference_type stride) : data_{data}, index_{index}, stride_{stride} {}
+
+	/// Get the index of the current element in the view.
+	constexpr difference_type index() const { return index_; }
+
+	constexpr T & operator*() const { return data_[index_ * stride_]; }
+	constexpr T * operator->() const { return &**this; }
+	constexpr T & operator[](difference_type n) const { return data_[(index_ + n) * stride_]; }
+
+	constexpr strided_iterator & operator++() { ++index_; return *this; }
+	constexpr strided_iterator & operator--() { --index_; return *this; }
+	constexpr strided_iterator operator++(int) { strided_iterator old = *this; ++index_; return old; }
+	constexpr strided_iterator operator--(int) { strided_iterator old = *this; --index_; return old; }
+
+	constexpr strided_iterator & operator+=(difference_type n) { index_ += n; return *this; }
+	constexpr strided_iterator & operator-=(difference_type n) { index_ -= n; return *this; }
+
+	friend constexpr strided_iterator operator+(strided_iterator it, difference_type n) { return it += n; }
+	friend constexpr strided_iterator operator+(difference_type n, strided_iterator it) { return it += n; }
+	friend constexpr strided_iterator operator-(strided_iterator it, difference_type n) { return it -= n; }
+	constexpr difference_type operator-(strided_iterator const & other) const { return index_ - other.index_; }
+
+	constexpr bool operator==(strided_iterator const & other) const { return index_ == other.index_; }
+	constexpr bool operator!=(strided_iterator const & other) const { return index_ != other.index_; }
+	constexpr bool operator< (strided_iterator const & other) const { return index_ <  other.index_; }
+	constexpr bool operator> (strided_iterator const & other) const { return index_ >  other.index_; }
+	constexpr bool operator<=(strided_iterator const & other) const { return index_ <= other.index_; }
+	constexpr bool operator>=(strided_iterator const & other) const { return index_ >= other.index_; }
+};
+
+/// A non-owning view on a range of elements with a fixed distance between them.
+/**
+ * The stride is measured in elements.
+ * This can be used to view one channel of interleaved data, or a column of a row-major matrix, without copying.
+ */
+template<typename T>
+class strided_view {
+public:
+	using value_type       = std::remove_const_t<T>;
+	using reference        = T &;
+	using const_reference  = T const &;
+	using iterator         = strided_iterator<T>;
+	using const_iterator   = strided_iterator<T const>;
+	using difference_type  = std::ptrdiff_t;
+	using size_type        = std::size_t;
+
+private:
+	/// Pointer to the first element.
+	T * data_;
+
+	/// The number of elements.
+	std::size_t size_;
+
+	/// The distance between elements.
+	std::size_t stride_;
+
+public:
+	/// Create an empty view.
+	constexpr strided_view() : data_{nullptr}, size_{0}, stride_{1} {}
+
+	/// Create a view from a pointer to the first element, the number of elements and the stride.
+	constexpr strided_view(T * data, std::size_t size, std::size_t stride) : data_{data}, size_{size}, stride_{stride} {}
+
+	/// Create a view of every `stride`-th element of a contiguous view, starting at `offset`.
+	/**
+	 * \throws std::invalid_argument if the stride is zero.
+	 */
+	strided_view(view<T> data, std::size_t stride, std::size_t offset = 0) :
+		data_{data.data() + std::min(offset, data.size())},
+		size_{offset < data.size() && stride ? (data.size() - offset + stride - 1) / stride : 0},
+		stride_{stride}
+	{
+		if (stride == 0) throw std::invalid_argument("stride of strided_view must not be zero");
+	}
+
+	/// Allow implicit conversion of a strided_view<T> to a strided_view<T const>.
+	constexpr operator strided_view<T const>() const {
+		return {data_, size_, stride_};
+	}
+
+	/// Get an iterator to the first element.
+	constexpr iterator begin() const { return {data_, 0, difference_type(stride_)}; }
+	constexpr const_iterator cbegin() const { return {data_, 0, difference_type(stride_)}; }
+
+	/// Get an iterator directly past the last element.
+	constexpr iterator end() const { return {data_, difference_type(size_), difference_type(stride_)}; }
+	constexpr const_iterator cend() const { return {data_, difference_type(size_), difference_type(stride_)}; }
+
+	/// Get a pointer to the first element.
+	constexpr T * data() const { return data_; }
+
+	/// Get the number of elements in the view.
+	constexpr std::size_t size() const { return size_; }
+
+	/// Check if the view is empty.
+	constexpr bool empty() const { return size_ == 0; }
+
+	/// Get the distance in elements between two consecutive elements.
+	constexpr std::size_t stride() const { return stride_; }
+
+	/// Check if the elements are contiguous in memory.
+	constexpr bool is_contiguous() const { return stride_ == 1 || size_ <= 1; }
+
+	/// Get a reference to an element by index, without bounds checking.
+	constexpr T & operator[] (std::size_t i) const {
+		return data_[i * stride_];
+	}
+
+	/// Get a reference to an element by index, with bounds checking.
+	/**
+	 * \throws std::range_error if the index is out of bounds.
+	 */
+	T & at(std::size_t i) const {
+		if (i >= size()) throw std::range_error("index " + std::to_string(i) + " out of range, view size is " + std::to_string(size()));
+		return data_[i * stride_];
+	}
+};
+
+namespace detail {
+#ifdef ESTD_HAVE_X86_DISPATCH
+	/// Gather 32 bit elements using AVX2 gather instructions.
+	ESTD_TARGET("avx2") inline std::size_t gather_avx2_32(std::uint32_t const * source, std::size_t size, std::size_t stride, std::uint32_t * destination) {
+		if (stride > std::size_t(0x7fffffff) / 8) return 0;
+		__m256i const offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(int(stride)));
+		std::size_t i = 0;
+		for (; i + 8 <= size; i += 8) {
+			__m256i values = _mm256_i32gather_epi32(reinterpret_cast<int const *>(source + i * stride), offsets, 4);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), values);
+		}
+		return i;
+	}
+#endif
+}
+
+/// Copy the elements of a strided view into a contiguous view.
+/**
+ * If the CPU supports AVX2, 4-byte trivially copyable elements are copied with gather instructions.
+ *
+ * \throws std::length_error if the destination is too small.
+ */
+template<typename T>
+void gather_to(strided_view<T> source, view<std::remove_const_t<T>> destination) {
+	if (destination.size() < source.size()) {
+		throw std::length_error("destination of size " + std::to_string(destination.size()) + " is too small to gather " + std::to_string(source.size()) + " elements");
+	}
+
+	std::size_t i = 0;
+	if (source.is_contiguous()) {
+		std::copy_n(source.data(), source.size(), destination.data());
+		return;
+	}
+
+#ifdef ESTD_HAVE_X86_DISPATCH
+	if constexpr (sizeof(T) == 4 && std::is_trivially_copyable_v<T>) {
+		if (cpu_has_avx2()) i = detail::gather_avx2_32(reinterpret_cast<std::uint32_t const *>(source.data()), source.size(), source.stride(), reinterpret_cast<std::uint32_t *>(destination.data()));
+	}
+#endif
+
+	for (; i < source.size(); ++i) destination[i] = source[i];
+}
+
+}
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "../traits/containers.hpp"
+#include "./detail/compare.hpp"
 
 #include <algorithm>
 #include <cstdint>
@@ -39,6 +40,9 @@
 
 namespace estd {
 
+/// Index returned by the search functions when nothing was found.
+constexpr std::size_t npos = std::size_t(-1);
+
 /// A non-owning view on a range of elements.
 template<typename T>
 class view {
@@ -148,18 +152,43 @@ public:
 	/// Compare two views for equality.
 	/**
 	 * Two views are considered equal if the range of elements compare equal.
+	 *
+	 * Views of integers, enums and pointers are compared with memcmp.
 	 */
-	bool operator==(view const & other) {
-		return size() == other.size() && std::equal(begin(), end(), other.begin());
+	bool operator==(view const & other) const {
+		return size() == other.size() && detail::compare::equal<std::remove_const_t<T>>(begin(), other.begin(), size());
 	}
 
 	/// Compare two views for inequality.
 	/**
 	 * Two views are considered equal if the range of elements compare equal.
 	 */
-	bool operator!=(view const & other) {
+	bool operator!=(view const & other) const {
 		return !(*this == other);
 	}
+
+	/// Compare two views lexicographically.
+	/**
+	 * Views of unsigned bytes are compared with memcmp,
+	 * and views of other integers, enums and pointers are scanned for the first difference with SIMD instructions.
+	 *
+	 * \return A negative value if this view sorts before the other view, zero if they are equal, and a positive value otherwise.
+	 */
+	int compare(view const & other) const {
+		return detail::compare::lexicographic<std::remove_const_t<T>>(begin(), size(), other.begin(), other.size());
+	}
+
+	/// Check if this view sorts lexicographically before another view.
+	bool operator<(view const & other) const { return compare(other) < 0; }
+
+	/// Check if this view sorts lexicographically before or equal to another view.
+	bool operator<=(view const & other) const { return compare(other) <= 0; }
+
+	/// Check if this view sorts lexicographically after another view.
+	bool operator>(view const & other) const { return compare(other) > 0; }
+
+	/// Check if this view sorts lexicographically after or equal to another view.
+	bool operator>=(view const & other) const { return compare(other) >= 0; }
 };
 
 /// Compare a view<CharT> for equality with a std::basic_string_view<CharT>
@@ -0,0 +1,85 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "./view.hpp"
+#include "../result/error.hpp"
+#include "../result/result.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace estd {
+
+/// Reinterpret a view as a view of another element type.
+/**
+ * Both element types must be trivially copyable, and the cast may not remove const.
+ *
+ * Fails with std::errc::invalid_argument if the byte size of the view is not a multiple of sizeof(U),
+ * or if the data is not suitably aligned for U.
+ * An empty view can always be cast, even if its data pointer is not aligned for U.
+ * The result is then an empty view with a null data pointer.
+ *
+ * Use this to parse binary payloads without copying, for example to turn a byte_view into a `view<float const>`.
+ */
+template<typename U, typename T>
+result<view<U>, error> view_cast(view<T> data) {
+	static_assert(std::is_trivially_copyable_v<std::remove_const_t<T>>, "only views of trivially copyable types can be reinterpreted");
+	static_assert(std::is_trivially_copyable_v<std::remove_const_t<U>>, "views can only be reinterpreted as trivially copyable types");
+	static_assert(std::is_const_v<U> || !std::is_const_v<T>, "view_cast can not cast away const");
+
+	std::size_t byte_size = data.size() * sizeof(T);
+	if (byte_size == 0) return view<U>{static_cast<U *>(nullptr), std::size_t(0)};
+	if (byte_size % sizeof(U) != 0) {
+		return error{std::errc::invalid_argument, "byte size of view (" + std::to_string(byte_size) + ") is not a multiple of the element size (" + std::to_string(sizeof(U)) + ")"};
+	}
+	if (reinterpret_cast<std::uintptr_t>(data.data()) % alignof(U) != 0) {
+		return error{std::errc::invalid_argument, "view data is not aligned to " + std::to_string(alignof(U)) + " bytes"};
+	}
+	return view<U>{reinterpret_cast<U *>(data.data()), byte_size / sizeof(U)};
+}
+
+/// Get a view of the bytes of the elements of a view.
+template<typename T>
+byte_view as_bytes(view<T> data) {
+	static_assert(std::is_trivially_copyable_v<std::remove_const_t<T>>, "only views of trivially copyable types can be viewed as bytes");
+	return {reinterpret_cast<std::uint8_t const *>(data.data()), data.size() * sizeof(T)};
+}
+
+/// Get a mutable view of the bytes of the elements of a mutable view.
+template<typename T>
+mut_byte_view as_writable_bytes(view<T> data) {
+	static_assert(std::is_trivially_copyable_v<T>, "only views of trivially copyable types can be viewed as bytes");
+	static_assert(!std::is_const_v<T>, "as_writable_bytes can not cast away const");
+	return {reinterpret_cast<std::uint8_t *>(data.data()), data.size() * sizeof(T)};
+}
+
+}
@@ -0,0 +1,168 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include "./view.hpp"
+#include "../range/detail/index_iterator.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+
+#include <sys/uio.h>
+
+namespace estd {
+
+/// List of byte views for vectored I/O, stored inline.
+/**
+ * The views are stored as an array of `struct iovec`,
+ * so the list can be passed directly to `writev()` or `sendmsg()` without any conversion:
+ *
+ *     ::writev(fd, list.data(), int(list.size()));
+ *
+ * The list does not own the viewed data.
+ */
+template<std::size_t N = 8>
+class view_list {
+private:
+	/// Source for iterators, indexing the iovec array as byte views.
+	struct elements {
+		iovec const * data = nullptr;
+		byte_view operator[](std::size_t i) const { return {static_cast<std::uint8_t const *>(data[i].iov_base), data[i].iov_len}; }
+	};
+
+	/// The views.
+	iovec views_[N];
+
+	/// The number of views in the list.
+	std::size_t size_ = 0;
+
+	/// The total size of all views.
+	std::size_t total_size_ = 0;
+
+public:
+	using iterator       = detail::index_iterator<elements>;
+	using const_iterator = iterator;
+	using value_type     = byte_view;
+
+	/// Create an empty list.
+	view_list() = default;
+
+	/// Create a list from a number of views.
+	/**
+	 * \throws std::length_error if there are more than N views.
+	 */
+	view_list(std::initializer_list<byte_view> views) {
+		for (byte_view view : views) push_back(view);
+	}
+
+	/// Get the number of views in the list.
+	std::size_t size() const { return size_; }
+
+	/// Get the maximum number of views in the list.
+	static constexpr std::size_t capacity() { return N; }
+
+	/// Check if the list contains no views.
+	bool empty() const { return size_ == 0; }
+
+	/// Get the total number of bytes of all views.
+	std::size_t total_size() const { return total_size_; }
+
+	/// Get a pointer to the views as an iovec array.
+	iovec const * data() const { return views_; }
+
+	/// Get a pointer to the views as a mutable iovec array, as needed by `struct msghdr`.
+	/**
+	 * If the array is modified through this pointer, total_size() will be wrong.
+	 */
+	iovec * data() { return views_; }
+
+	/// Get a view by index, without bounds checking.
+	byte_view operator[](std::size_t i) const { return elements{views_}[i]; }
+
+	iterator begin() const { return {elements{views_}, 0}; }
+	iterator end() const { return {elements{views_}, size_}; }
+
+	/// Add a view to the end of the list.
+	/**
+	 * \throws std::length_error if the list is full.
+	 */
+	void push_back(byte_view view) {
+		if (size_ == N) throw std::length_error("view_list is full, it can hold at most " + std::to_string(N) + " views");
+		views_[size_++] = iovec{const_cast<std::uint8_t *>(view.data()), view.size()};
+		total_size_ += view.size();
+	}
+
+	/// Remove all views.
+	void clear() {
+		size_ = 0;
+		total_size_ = 0;
+	}
+
+	/// Remove a number of bytes from the front of the list, for example after a partial write.
+	/**
+	 * Views that are consumed completely are removed, and a partially consumed view is shortened.
+	 * Consuming more bytes than the total size clears the list.
+	 */
+	void consume(std::size_t bytes) {
+		if (bytes >= total_size_) return clear();
+		total_size_ -= bytes;
+
+		std::size_t first = 0;
+		while (bytes >= views_[first].iov_len) bytes -= views_[first++].iov_len;
+		views_[first].iov_base = static_cast<std::uint8_t *>(views_[first].iov_base) + bytes;
+		views_[first].iov_len -= bytes;
+
+		std::copy(views_ + first, views_ + size_, views_);
+		size_ -= first;
+	}
+
+	/// Copy the contents of all views into one contiguous buffer.
+	/**
+	 * \return The number of bytes copied, which is always total_size().
+	 * \throws std::length_error if the destination is too small.
+	 */
+	std::size_t copy_to(mut_byte_view destination) const {
+		if (destination.size() < total_size_) {
+			throw std::length_error("destination of size " + std::to_string(destination.size()) + " is too small for " + std::to_string(total_size_) + " bytes");
+		}
+		std::uint8_t * output = destination.data();
+		for (std::size_t i = 0; i < size_; ++i) {
+			if (views_[i].iov_len > 0) std::memcpy(output, views_[i].iov_base, views_[i].iov_len);
+			output += views_[i].iov_len;
+		}
+		return total_size_;
+	}
+};
+
+}
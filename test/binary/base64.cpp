@@ -0,0 +1,139 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "binary/base64.hpp"
+#include "result/catch_string_conversions.hpp"
+
+#include "../bytes.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace estd {
+
+namespace {
+	std::string text(byte_heap_array const & data) {
+		return {reinterpret_cast<char const *>(data.data()), data.size()};
+	}
+
+	std::string scalar_base64(byte_view input) {
+		std::string result(base64_encoded_size(input.size()), '\0');
+		detail::base64::encode_scalar(input.data(), input.size(), result.data());
+		return result;
+	}
+}
+
+TEST_CASE("base64 matches the RFC 4648 test vectors", "[base64]") {
+	std::pair<std::string_view, std::string_view> vectors[] = {
+		{"",       ""},
+		{"f",      "Zg=="},
+		{"fo",     "Zm8="},
+		{"foo",    "Zm9v"},
+		{"foob",   "Zm9vYg=="},
+		{"fooba",  "Zm9vYmE="},
+		{"foobar", "Zm9vYmFy"},
+	};
+
+	for (auto [plain, encoded] : vectors) {
+		REQUIRE(to_base64(bytes(plain)) == encoded);
+		REQUIRE(text(from_base64(encoded).value()) == plain);
+	}
+}
+
+TEST_CASE("base64 encoding writes into caller-provided buffers", "[base64]") {
+	char buffer[8];
+	REQUIRE(to_base64(bytes("foob"), view<char>{buffer, sizeof(buffer)}) == 8);
+	REQUIRE(std::string_view{buffer, 8} == "Zm9vYg==");
+	REQUIRE_THROWS_AS(to_base64(bytes("foobar!"), view<char>{buffer, sizeof(buffer)}), std::length_error);
+
+	std::string output;
+	output.reserve(64);
+	char const * storage = output.data();
+	to_base64(bytes("foobar"), output);
+	REQUIRE(output == "Zm9vYmFy");
+	REQUIRE(output.data() == storage);
+
+	std::uint8_t decoded[3];
+	REQUIRE(from_base64("Zm9vYg==", mut_byte_view{decoded, 3}).error_or() == std::errc::no_buffer_space);
+	REQUIRE(*from_base64("Zm9v", mut_byte_view{decoded, 3}) == 3);
+}
+
+TEST_CASE("base64 encoding and decoding round trips for all sizes", "[base64]") {
+	std::vector<std::uint8_t> data = test_data(300);
+
+	for (std::size_t size = 0; size <= data.size(); ++size) {
+		byte_view input{data.data(), size};
+		std::string encoded = to_base64(input);
+		REQUIRE(encoded == scalar_base64(input));
+
+		result<byte_heap_array, error> decoded = from_base64(encoded);
+		REQUIRE(decoded);
+		REQUIRE(std::equal(decoded->begin(), decoded->end(), input.begin(), input.end()));
+	}
+}
+
+TEST_CASE("from_base64 rejects invalid input", "[base64]") {
+	REQUIRE(from_base64("Zm9").error_or() == std::errc::invalid_argument);
+	REQUIRE(from_base64("Zg=a").error_or() == std::errc::invalid_argument);
+	REQUIRE(from_base64("Z===").error_or() == std::errc::invalid_argument);
+	REQUIRE(from_base64("Zg==Zm9v").error_or() == std::errc::invalid_argument);
+
+	// Check every byte value that is not in the alphabet, inside and after the vectorized blocks.
+	std::string encoded = to_base64(test_data(48));
+	for (std::size_t position : {0, 5, 31, 32, 63}) {
+		for (int c = 0; c < 256; ++c) {
+			// Padding at the end is valid, it just encodes fewer bytes.
+			if (detail::base64::values[c] != 0xff || (c == '=' && position == encoded.size() - 1)) continue;
+			std::string corrupt = encoded;
+			corrupt[position] = char(c);
+			result<byte_heap_array, error> decoded = from_base64(corrupt);
+			REQUIRE(decoded.error_or() == std::errc::invalid_argument);
+			REQUIRE(decoded.error_unchecked().description.back() == "invalid base64 character at offset " + std::to_string(position));
+		}
+	}
+}
+
+TEST_CASE("base64 encoding is available as a conversion", "[base64]") {
+	byte_heap_array data{'f', 'o', 'o'};
+	REQUIRE(convert<std::string, base64_encoding>(data) == "Zm9v");
+
+	result<byte_heap_array, error> parsed = parse<byte_heap_array, error, base64_encoding>("Zm9v");
+	REQUIRE(parsed);
+	REQUIRE(*parsed == data);
+	REQUIRE(parse<byte_heap_array, error, base64_encoding>(std::string{"Zm9"}).error_or() == std::errc::invalid_argument);
+}
+
+}
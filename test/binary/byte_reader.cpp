@@ -0,0 +1,102 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "binary/byte_reader.hpp"
+#include "result/catch_string_conversions.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <cstdint>
+
+namespace estd {
+
+namespace {
+	std::uint8_t const message[] = {
+		0x01, 0x02, 0x03, 0x04,
+		0x01, 0x02, 0x03, 0x04,
+		0x00, 0x00, 0x80, 0x3f,
+		'a', 'b', 'c',
+	};
+}
+
+TEST_CASE("byte_reader reads values with explicit byte order", "[byte_reader]") {
+	byte_reader reader{byte_view{message, sizeof(message)}};
+	REQUIRE(reader.remaining() == 15);
+
+	REQUIRE(*reader.read_le<std::uint32_t>() == 0x04030201);
+	REQUIRE(*reader.read_be<std::uint16_t>() == 0x0102);
+	REQUIRE(*reader.read_be<std::int16_t>() == 0x0304);
+	REQUIRE(*reader.read_le<float>() == 1.0f);
+	REQUIRE(reader.position() == 12);
+
+	result<byte_view, error> text = reader.read_view(3);
+	REQUIRE(text);
+	REQUIRE(text->data() == message + 12);
+	REQUIRE(text->size() == 3);
+	REQUIRE(reader.empty());
+}
+
+TEST_CASE("byte_reader reports short reads without advancing", "[byte_reader]") {
+	byte_reader reader{byte_view{message, sizeof(message)}};
+	REQUIRE(reader.skip(12));
+
+	REQUIRE(reader.read<std::uint32_t>().error_or() == std::errc::message_size);
+	REQUIRE(reader.read_view(4).error_or() == std::errc::message_size);
+	REQUIRE(reader.skip(4).error_or() == std::errc::message_size);
+	REQUIRE(reader.position() == 12);
+	REQUIRE(reader.rest().size() == 3);
+	REQUIRE(*reader.read<std::uint8_t>() == 'a');
+}
+
+TEST_CASE("byte_reader can parse a validated message without bounds checks", "[byte_reader]") {
+	byte_reader reader{byte_view{message, sizeof(message)}};
+	REQUIRE(reader.require(12));
+	REQUIRE_FALSE(reader.require(16));
+
+	REQUIRE(reader.read_unchecked<std::uint32_t>() == (endian::native == endian::little ? 0x04030201 : 0x01020304));
+	reader.skip_unchecked(4);
+	REQUIRE(reader.read_le_unchecked<float>() == 1.0f);
+	REQUIRE(reader.read_view_unchecked(2).size() == 2);
+	REQUIRE(reader.read_be_unchecked<std::uint8_t>() == 'c');
+	REQUIRE(reader.empty());
+}
+
+TEST_CASE("byteswap reverses the bytes of a value", "[byte_reader]") {
+	REQUIRE(byteswap(std::uint16_t(0x1234)) == 0x3412);
+	REQUIRE(byteswap(std::uint32_t(0x12345678)) == 0x78563412);
+	REQUIRE(byteswap(std::uint64_t(0x0102030405060708)) == 0x0807060504030201);
+	REQUIRE(byteswap(byteswap(1.5)) == 1.5);
+	REQUIRE(byteswap(std::int8_t(-3)) == -3);
+}
+
+}
@@ -0,0 +1,160 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "binary/byte_reader.hpp"
+#include "binary/byte_writer.hpp"
+#include "result/catch_string_conversions.hpp"
+
+#include "../bytes.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace estd {
+
+namespace {
+	std::vector<std::uint8_t> to_vector(byte_view data) {
+		return {data.begin(), data.end()};
+	}
+}
+
+TEST_CASE("byte_writer writes values with explicit byte order", "[byte_writer]") {
+	std::uint8_t buffer[16];
+	byte_writer writer{mut_byte_view{buffer, sizeof(buffer)}};
+	REQUIRE(!writer.is_growable());
+
+	REQUIRE(writer.write_le(std::uint32_t(0x04030201)));
+	REQUIRE(writer.write_be(std::uint16_t(0x0102)));
+	REQUIRE(writer.write_le(1.0f));
+	REQUIRE(writer.write_view(bytes("abc")));
+	REQUIRE(writer.write(std::uint8_t(0xff)));
+	REQUIRE(writer.position() == 14);
+	REQUIRE(to_vector(writer.written()) == std::vector<std::uint8_t>{1, 2, 3, 4, 1, 2, 0x00, 0x00, 0x80, 0x3f, 'a', 'b', 'c', 0xff});
+
+	byte_reader reader{writer.written()};
+	REQUIRE(*reader.read_le<std::uint32_t>() == 0x04030201);
+	REQUIRE(*reader.read_be<std::uint16_t>() == 0x0102);
+	REQUIRE(*reader.read_le<float>() == 1.0f);
+}
+
+TEST_CASE("byte_writer reports overflow of a fixed buffer without writing", "[byte_writer]") {
+	std::uint8_t buffer[6];
+	byte_writer writer{mut_byte_view{buffer, sizeof(buffer)}};
+	REQUIRE(writer.write_be(std::uint32_t(1)));
+
+	REQUIRE(writer.write_be(std::uint32_t(2)).error_or() == std::errc::message_size);
+	REQUIRE(writer.write_view(bytes("abc")).error_or() == std::errc::message_size);
+	REQUIRE(writer.skip(3).error_or() == std::errc::message_size);
+	REQUIRE(writer.reserve(3).error_or() == std::errc::message_size);
+	REQUIRE(writer.position() == 4);
+	REQUIRE(writer.remaining() == 2);
+	REQUIRE(writer.write_be(std::uint16_t(3)));
+	REQUIRE_THROWS_AS(writer.take(), std::logic_error);
+}
+
+TEST_CASE("byte_writer can be moved without throwing", "[byte_writer]") {
+	static_assert(std::is_nothrow_move_constructible_v<byte_writer>);
+	static_assert(std::is_nothrow_move_assignable_v<byte_writer>);
+}
+
+TEST_CASE("growable byte_writer grows its buffer", "[byte_writer]") {
+	byte_writer writer = byte_writer::growable(4);
+	REQUIRE(writer.is_growable());
+
+	for (std::uint32_t i = 0; i < 100; ++i) REQUIRE(writer.write_be(i));
+	REQUIRE(writer.position() == 400);
+	REQUIRE(writer.capacity() >= 400);
+	REQUIRE(writer.capacity() < 800);
+
+	byte_heap_array result = writer.take();
+	REQUIRE(result.size() == 400);
+	REQUIRE(writer.position() == 0);
+
+	byte_reader reader{byte_view{result.data(), result.size()}};
+	REQUIRE(reader.require(400));
+	for (std::uint32_t i = 0; i < 100; ++i) REQUIRE(reader.read_be_unchecked<std::uint32_t>() == i);
+
+	REQUIRE(writer.write_view(bytes("reused")));
+	REQUIRE(writer.take().size() == 6);
+}
+
+TEST_CASE("growable byte_writer hands out an exactly full buffer without copying", "[byte_writer]") {
+	byte_writer writer = byte_writer::growable(6);
+	REQUIRE(writer.write_view(bytes("abcdef")));
+	std::uint8_t const * data = writer.written().data();
+
+	byte_heap_array result = writer.take();
+	REQUIRE(result.data() == data);
+	REQUIRE(result.size() == 6);
+}
+
+TEST_CASE("growable byte_writer rejects sizes that overflow", "[byte_writer]") {
+	byte_writer writer = byte_writer::growable(32);
+	REQUIRE(writer.write_be(std::uint32_t(1)));
+
+	// Volatile, so GCC does not warn about the huge memset in skip() that it can not prove is unreachable.
+	std::size_t volatile max_size = std::numeric_limits<std::size_t>::max();
+	REQUIRE(writer.reserve(max_size - 2).error_or() == std::errc::message_size);
+	REQUIRE(writer.skip(max_size - 2).error_or() == std::errc::message_size);
+	REQUIRE(writer.position() == 4);
+	REQUIRE(writer.capacity() == 32);
+}
+
+TEST_CASE("byte_writer can back-patch length prefixes", "[byte_writer]") {
+	byte_writer writer = byte_writer::growable(2);
+
+	std::size_t length_offset = *writer.skip(2);
+	REQUIRE(writer.reserve(5));
+	writer.write_view_unchecked(bytes("hello"));
+	writer.patch_be(length_offset, std::uint16_t(writer.position() - length_offset - 2));
+	REQUIRE_THROWS_AS(writer.patch_be(6, std::uint16_t(0)), std::range_error);
+
+	REQUIRE(to_vector(writer.written()) == std::vector<std::uint8_t>{0, 5, 'h', 'e', 'l', 'l', 'o'});
+}
+
+TEST_CASE("byte_writer can be moved", "[byte_writer]") {
+	byte_writer writer = byte_writer::growable(1);
+	REQUIRE(writer.write_view(bytes("abc")));
+
+	byte_writer other = std::move(writer);
+	REQUIRE(other.position() == 3);
+	REQUIRE(other.write_view(bytes("def")));
+	REQUIRE(to_vector(other.written()) == to_vector(bytes("abcdef")));
+}
+
+}
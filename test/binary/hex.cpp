@@ -0,0 +1,125 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "binary/hex.hpp"
+#include "result/catch_string_conversions.hpp"
+
+#include "../bytes.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace estd {
+
+namespace {
+	std::string scalar_hex(byte_view input) {
+		std::string result(2 * input.size(), '\0');
+		detail::hex::encode_scalar(input.data(), input.size(), result.data());
+		return result;
+	}
+}
+
+TEST_CASE("to_hex encodes bytes as lowercase hex", "[hex]") {
+	REQUIRE(to_hex(bytes("")) == "");
+	REQUIRE(to_hex(bytes("\x01\xab\xff")) == "01abff");
+	REQUIRE(to_hex(bytes("hello")) == "68656c6c6f");
+
+	SECTION("into a caller-provided buffer") {
+		char buffer[8];
+		REQUIRE(to_hex(bytes("\xde\xad"), view<char>{buffer, sizeof(buffer)}) == 4);
+		REQUIRE(std::string_view{buffer, 4} == "dead");
+		REQUIRE_THROWS_AS(to_hex(bytes("hello"), view<char>{buffer, sizeof(buffer)}), std::length_error);
+
+		std::string output;
+		output.reserve(64);
+		char const * storage = output.data();
+		to_hex(bytes("\xbe\xef"), output);
+		REQUIRE(output == "beef");
+		REQUIRE(output.data() == storage);
+	}
+}
+
+TEST_CASE("from_hex decodes hex in either case", "[hex]") {
+	REQUIRE(from_hex("").value().size() == 0);
+	byte_heap_array decoded = from_hex("01aBfF").value();
+	REQUIRE(std::vector<std::uint8_t>(decoded.begin(), decoded.end()) == std::vector<std::uint8_t>{0x01, 0xab, 0xff});
+
+	std::uint8_t buffer[2];
+	REQUIRE(from_hex("abc").error_or() == std::errc::invalid_argument);
+	REQUIRE(from_hex("abcdef", mut_byte_view{buffer, 2}).error_or() == std::errc::no_buffer_space);
+	REQUIRE(*from_hex("ab", mut_byte_view{buffer, 2}) == 1);
+}
+
+TEST_CASE("hex encoding and decoding round trips for all sizes", "[hex]") {
+	std::vector<std::uint8_t> data = test_data(300);
+
+	for (std::size_t size = 0; size <= data.size(); ++size) {
+		byte_view input{data.data(), size};
+		std::string encoded = to_hex(input);
+		REQUIRE(encoded == scalar_hex(input));
+
+		result<byte_heap_array, error> decoded = from_hex(encoded);
+		REQUIRE(decoded);
+		REQUIRE(std::equal(decoded->begin(), decoded->end(), input.begin(), input.end()));
+	}
+}
+
+TEST_CASE("from_hex reports the offset of invalid characters", "[hex]") {
+	std::string encoded = to_hex(test_data(64));
+
+	for (std::size_t position : {0, 1, 31, 32, 63, 100, 127}) {
+		for (char invalid : {'g', 'G', '/', ':', '@', '`', ' ', '\0', '\xff'}) {
+			std::string corrupt = encoded;
+			corrupt[position] = invalid;
+			result<byte_heap_array, error> decoded = from_hex(corrupt);
+			REQUIRE(decoded.error_or() == std::errc::invalid_argument);
+			REQUIRE(decoded.error_unchecked().description.back() == "invalid hex digit at offset " + std::to_string(position));
+		}
+	}
+}
+
+TEST_CASE("hex encoding is available as a conversion", "[hex]") {
+	byte_heap_array data{0x12, 0x34};
+	REQUIRE(convert<std::string, hex_encoding>(data) == "1234");
+	REQUIRE(convert<std::string, hex_encoding>(bytes("\xff")) == "ff");
+
+	result<byte_heap_array, error> parsed = parse<byte_heap_array, error, hex_encoding>("1234");
+	REQUIRE(parsed);
+	REQUIRE(*parsed == data);
+	REQUIRE(parse<byte_heap_array, error, hex_encoding>(std::string{"123"}).error_or() == std::errc::invalid_argument);
+}
+
+}
@@ -0,0 +1,88 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "hash/crc32c.hpp"
+
+#include "../bytes.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <numeric>
+#include <string_view>
+#include <vector>
+
+namespace estd {
+
+TEST_CASE("crc32c matches the reference values", "[crc32c]") {
+	std::vector<std::uint8_t> zeros(32, 0x00);
+	std::vector<std::uint8_t> ones(32, 0xff);
+	std::vector<std::uint8_t> increasing(32);
+	std::iota(increasing.begin(), increasing.end(), 0);
+
+	REQUIRE(crc32c(bytes("")) == 0);
+	REQUIRE(crc32c(bytes("123456789")) == 0xE3069283);
+	REQUIRE(crc32c(zeros) == 0x8A9136AA);
+	REQUIRE(crc32c(ones) == 0x62A8AB43);
+	REQUIRE(crc32c(increasing) == 0x46DD794E);
+}
+
+TEST_CASE("crc32c can be computed incrementally", "[crc32c]") {
+	REQUIRE(crc32c(bytes("56789"), crc32c(bytes("1234"))) == 0xE3069283);
+
+	std::vector<std::uint8_t> data(3 * 8192 * 2 + 1000);
+	for (std::size_t i = 0; i < data.size(); ++i) data[i] = std::uint8_t(i * 31 + (i >> 8));
+	std::uint32_t expected = crc32c(data);
+
+	for (std::size_t split : {0, 1, 255, 768, 8192, 3 * 8192 + 7}) {
+		std::uint32_t crc = crc32c(byte_view{data.data(), split});
+		REQUIRE(crc32c(byte_view{data.data() + split, data.size() - split}, crc) == expected);
+	}
+}
+
+TEST_CASE("the hardware and software implementations agree", "[crc32c]") {
+	using detail::crc32c::long_block;
+	using detail::crc32c::short_block;
+	std::vector<std::uint8_t> data(3 * long_block + 3 * short_block + 21);
+	for (std::size_t i = 0; i < data.size(); ++i) data[i] = std::uint8_t(i * 131 + 7);
+
+	// Cover the interleaved long and short blocks, whole words and trailing bytes.
+	for (std::size_t size : {std::size_t(0), std::size_t(7), std::size_t(8), std::size_t(100), 3 * short_block, 3 * short_block + 9, 3 * long_block, data.size()}) {
+		std::uint32_t software = ~detail::crc32c::software(~0u, data.data(), size);
+		REQUIRE(crc32c(byte_view{data.data(), size}) == software);
+#ifdef ESTD_HAVE_X86_DISPATCH
+		if (cpu_has_sse42()) REQUIRE(~detail::crc32c::hardware(~0u, data.data(), size) == software);
+#endif
+	}
+}
+
+}
@@ -0,0 +1,205 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "hash/hash.hpp"
+
+#include "../bytes.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace estd {
+
+namespace {
+	struct padded {
+		std::uint8_t a;
+		std::uint32_t b;
+	};
+}
+
+TEST_CASE("hash matches the XXH3 reference values", "[hash]") {
+	REQUIRE(hash(bytes("")) == 0x2D06800538D394C2ULL);
+	REQUIRE(hash(bytes("a")) == 0xE6C632B61E964E1FULL);
+	REQUIRE(hash(bytes("abc")) == 0x78AF5F94892F3950ULL);
+	REQUIRE(hash(bytes("message digest")) == 0x160D8E9329BE94F9ULL);
+	REQUIRE(hash(bytes("abcdefghijklmnopqrstuvwxyz")) == 0x810F9CA067FBB90CULL);
+	REQUIRE(hash(bytes("12345678901234567890123456789012345678901234567890123456789012345678901234567890")) == 0x7F58AA2520C681F9ULL);
+}
+
+TEST_CASE("hash matches the XXH3 reference values for all input sizes", "[hash]") {
+	struct reference {
+		std::size_t size;
+		std::uint64_t unseeded;
+		std::uint64_t seeded;
+	};
+
+	// Computed with the reference XXH3_64bits() and XXH3_64bits_withSeed() on bytes i * 7.
+	reference const references[] = {
+		{0, 0x2D06800538D394C2ULL, 0x602B0E2CD6662C8BULL},
+		{1, 0xC44BDFF4074EECDBULL, 0x062B185E4E01441AULL},
+		{3, 0xC3489259E968AD9EULL, 0x71A5F088B9BF6B14ULL},
+		{4, 0xD3D60C1519014E89ULL, 0x725545A3F20014CEULL},
+		{8, 0xB88DEE77F6BF6980ULL, 0x3F5DA5B7AD256DE3ULL},
+		{9, 0x03688DCAD730D826ULL, 0xC332DEB897105A63ULL},
+		{16, 0x9DA23836ADF2BE1EULL, 0x6C542998420CA675ULL},
+		{17, 0xF34C3C9CF5A112D1ULL, 0x215D8E2B47EB92DBULL},
+		{32, 0x99CB9AD0F1A11FBEULL, 0xFB3F4B8D28EEEE3EULL},
+		{33, 0xC077B45492D29CDEULL, 0xC8A6F70C35A26C32ULL},
+		{64, 0x6EFB76FF16F37561ULL, 0x480C38D0A89BE795ULL},
+		{65, 0x2640848E9137156BULL, 0xF9D2E523A54C1A71ULL},
+		{96, 0x764D2D5DB92942DFULL, 0xCF27355E271B5644ULL},
+		{97, 0x077ACB7E5F4FD940ULL, 0xB8C0285F5FFA2A77ULL},
+		{128, 0x65F3C2C00FA93185ULL, 0x65C2E94EA7B79257ULL},
+		{129, 0x28065C6EC25F5B25ULL, 0x17F705A26996F1C9ULL},
+		{200, 0x7C64F3B17285E96AULL, 0x8D9AC599068D0AAEULL},
+		{240, 0x4917A75C0EF8EED7ULL, 0xF906157A86B7EAC3ULL},
+		{241, 0x541B19226F0052E8ULL, 0x6EC6D69819587A84ULL},
+		{1024, 0xDC5ACF0B043C445BULL, 0x40172938D0E7F70FULL},
+		{1025, 0xE1D9CD946277AE26ULL, 0xBA11213CC12200E2ULL},
+		{2048, 0x848D24CC268F7498ULL, 0x5850F07264CE7D01ULL},
+		{4096, 0x8FB047A89E810965ULL, 0x10B6D45F17B62393ULL},
+		{5000, 0x6ABE8BE5ABCB2760ULL, 0x9CAE3050DBCF6CA2ULL},
+	};
+
+	std::vector<std::uint8_t> data(5000);
+	for (std::size_t i = 0; i < data.size(); ++i) data[i] = std::uint8_t(i * 7);
+
+	for (reference const & expected : references) {
+		byte_view input{data.data(), expected.size};
+		REQUIRE(hash(input) == expected.unseeded);
+		REQUIRE(hash(input, 0x9E3779B97F4A7C15ULL) == expected.seeded);
+	}
+}
+
+TEST_CASE("the seed changes the hash", "[hash]") {
+	REQUIRE(hash(bytes("abc"), 1) != hash(bytes("abc")));
+	REQUIRE(hash(bytes("abc"), 1) == hash(bytes("abc"), 1));
+}
+
+TEST_CASE("the AVX2 kernels match the scalar kernels", "[hash]") {
+#ifdef ESTD_HAVE_X86_DISPATCH
+	if (!cpu_has_avx2()) return;
+
+	std::vector<std::uint8_t> data(16 * 64 + 3);
+	for (std::size_t i = 0; i < data.size(); ++i) data[i] = std::uint8_t(i * 131 + 17);
+
+	std::uint64_t scalar[8];
+	std::uint64_t avx2[8];
+	detail::hash::init_accumulators(scalar);
+	detail::hash::init_accumulators(avx2);
+
+	// Use an unaligned input and secret, like the last stripe does.
+	detail::hash::accumulate_scalar(scalar, data.data() + 3, detail::hash::default_secret, 16);
+	detail::hash::accumulate_avx2(avx2, data.data() + 3, detail::hash::default_secret, 16);
+	REQUIRE(std::equal(scalar, scalar + 8, avx2));
+
+	detail::hash::scramble_scalar(scalar, detail::hash::default_secret + 121);
+	detail::hash::scramble_avx2(avx2, detail::hash::default_secret + 121);
+	REQUIRE(std::equal(scalar, scalar + 8, avx2));
+#endif
+}
+
+TEST_CASE("incremental hashing matches one-shot hashing", "[hash]") {
+	std::vector<std::uint8_t> data(5000);
+	std::iota(data.begin(), data.end(), 0);
+
+	for (std::size_t size : {0, 3, 31, 32, 33, 100, 240, 241, 256, 257, 1000, 1024, 1025, 5000}) {
+		byte_view input{data.data(), size};
+		for (std::size_t chunk : {1, 5, 64, 100, 256, 257, 1000}) {
+			hasher state{7};
+			for (std::size_t i = 0; i < size; i += chunk) {
+				state.update(byte_view{data.data() + i, std::min(chunk, size - i)});
+			}
+			REQUIRE(state.digest() == hash(input, 7));
+		}
+	}
+
+	SECTION("the digest can be taken while hashing") {
+		hasher state;
+		state.update(bytes("abc"));
+		REQUIRE(state.digest() == hash(bytes("abc")));
+		state.update(bytes("defghijklmnopqrstuvwxyz"));
+		REQUIRE(state.digest() == hash(bytes("abcdefghijklmnopqrstuvwxyz")));
+		state.update(byte_view{data.data(), 3000});
+		state.update(byte_view{data.data(), 10});
+		std::vector<std::uint8_t> concatenated(data.begin(), data.begin() + 3000);
+		concatenated.insert(concatenated.begin(), {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z'});
+		concatenated.insert(concatenated.end(), data.begin(), data.begin() + 10);
+		REQUIRE(state.digest() == hash(byte_view{concatenated.data(), concatenated.size()}));
+		state.reset();
+		REQUIRE(state.digest() == hash(bytes("")));
+	}
+}
+
+TEST_CASE("views and heap arrays hash by contents", "[hash]") {
+	std::vector<std::uint32_t> values{1, 2, 3, 4};
+	heap_array<std::uint32_t> array{1, 2, 3, 4};
+
+	REQUIRE(hash(view<std::uint32_t const>{values}) == hash(array));
+	REQUIRE(hash(view<std::uint32_t>{values}) == hash(array));
+	REQUIRE(std::hash<view<std::uint32_t const>>{}(values) == std::hash<heap_array<std::uint32_t>>{}(array));
+
+	static_assert(std::is_default_constructible_v<std::hash<view<std::uint32_t const>>>);
+	static_assert(std::is_default_constructible_v<std::hash<heap_array<std::uint32_t>>>);
+	static_assert(!std::is_default_constructible_v<std::hash<view<float>>>);
+	static_assert(!std::is_default_constructible_v<std::hash<heap_array<padded>>>);
+	static_assert(!std::is_copy_constructible_v<std::hash<view<float const>>>);
+	static_assert(!std::is_invocable_v<std::hash<view<float>>, view<float> const &>);
+
+	static_assert(is_byte_hashable<std::uint32_t>);
+	static_assert(!is_byte_hashable<float>);
+	static_assert(!is_byte_hashable<padded>);
+}
+
+TEST_CASE("views can be used as keys in unordered containers", "[hash]") {
+	std::string_view a = "first key";
+	std::string_view b = "second key";
+	std::string copy{a};
+
+	std::unordered_map<byte_view, int> map;
+	map[bytes(a)] = 1;
+	map[bytes(b)] = 2;
+
+	REQUIRE(map.size() == 2);
+	REQUIRE(map.at(bytes(copy)) == 1);
+	REQUIRE(map.count(bytes("third key")) == 0);
+}
+
+}
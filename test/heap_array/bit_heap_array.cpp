@@ -0,0 +1,125 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "heap_array/bit_heap_array.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <utility>
+
+namespace estd {
+
+TEST_CASE("bit heap arrays can be created", "[heap_array]") {
+	bit_heap_array empty;
+	REQUIRE(empty.size() == 0);
+	REQUIRE(empty.empty());
+
+	bit_heap_array zeros = bit_heap_array::allocate(130);
+	REQUIRE(zeros.size() == 130);
+	REQUIRE(zeros.word_count() == 3);
+	REQUIRE(zeros.count() == 0);
+
+	bit_heap_array ones = bit_heap_array::allocate(130, true);
+	REQUIRE(ones.count() == 130);
+	REQUIRE(ones.words()[2] == 0x3);
+
+	bit_heap_array list = {true, false, true, true};
+	REQUIRE(list.size() == 4);
+	REQUIRE(list.words()[0] == 0xd);
+}
+
+TEST_CASE("bit heap arrays can be moved", "[heap_array]") {
+	bit_heap_array a = {true, true};
+	bit_heap_array b = std::move(a);
+	REQUIRE(b.size() == 2);
+	REQUIRE(a.size() == 0);
+
+	a = std::move(b);
+	REQUIRE(a.count() == 2);
+	REQUIRE(b.empty());
+}
+
+TEST_CASE("bit heap arrays give access to bits", "[heap_array]") {
+	bit_heap_array bits = bit_heap_array::allocate(200);
+	bits[5] = true;
+	bits.set(150);
+	bits.flip(151);
+	bits.flip(150);
+	REQUIRE(bits.test(5));
+	REQUIRE(std::as_const(bits)[151]);
+	REQUIRE(bits.find_first() == 5);
+	REQUIRE(bits.find_next(6) == 151);
+	REQUIRE(bits.count() == 2);
+
+	mut_bit_view view = bits;
+	view.reset(5);
+	REQUIRE(bits.find_first() == 151);
+
+	std::size_t set = 0;
+	for (bool bit : std::as_const(bits)) set += bit;
+	REQUIRE(set == 1);
+}
+
+TEST_CASE("bit heap arrays combine masks", "[heap_array]") {
+	bit_heap_array a = {true, true, false, false};
+	bit_heap_array b = {true, false, true, false};
+
+	bit_heap_array result = bit_heap_array::allocate(4);
+	result |= a;
+	result &= b;
+	REQUIRE(result == bit_heap_array{true, false, false, false});
+
+	result = bit_heap_array::allocate(4);
+	(result |= a) ^= b;
+	REQUIRE(result == bit_heap_array{false, true, true, false});
+
+	result.and_not(a);
+	REQUIRE(result == bit_heap_array{false, false, true, false});
+	REQUIRE(result != b);
+}
+
+TEST_CASE("bit heap arrays can be resized", "[heap_array]") {
+	bit_heap_array bits = bit_heap_array::allocate(100, true);
+	bits.resize(70);
+	REQUIRE(bits.count() == 70);
+	REQUIRE(bits.words()[1] == 0x3f);
+
+	bits.resize(200, true);
+	REQUIRE(bits.count() == 200);
+
+	bits.resize(300);
+	REQUIRE(bits.count() == 200);
+	REQUIRE(bits.find_next(200) == npos);
+}
+
+}
@@ -35,8 +35,16 @@
 #   include <catch2/catch.hpp>
 # endif
 
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
+#ifdef ESTD_HAVE_MEMORY_RESOURCE
+#  include <memory_resource>
+#endif
+
 namespace estd {
 
 TEST_CASE("constructors work", "[heap_array]") {
@@ -67,6 +75,8 @@ TEST_CASE("constructors work", "[heap_array]") {
 		REQUIRE(allocated_empty.data() == nullptr);
 	}
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 	SECTION("heap_array::unitialized() allocates the requested size", "[heap_array]") {
 		auto unitialized = heap_array<int>::unitialized(5);
 		REQUIRE(unitialized.size() == 5);
@@ -80,7 +90,15 @@ TEST_CASE("constructors work", "[heap_array]") {
 		REQUIRE(uninitialized_empty.empty() == true);
 		REQUIRE(uninitialized_empty.data() == nullptr);
 	}
+#pragma GCC diagnostic pop
 
+	SECTION("heap_array::uninitialized() default constructs non-trivial types", "[heap_array]") {
+		auto uninitialized = heap_array<std::string>::uninitialized(3);
+		REQUIRE(uninitialized.size() == 3);
+		REQUIRE(uninitialized[0] == "");
+		REQUIRE(uninitialized[1] == "");
+		REQUIRE(uninitialized[2] == "");
+	}
 
 	SECTION("heap_array{val, val, val, ...} initialized a new array with the given values", "[heap_array]") {
 		auto allocated = heap_array<int>{1, 2, 3, 4, 5};
@@ -135,6 +153,187 @@ TEST_CASE("basic observers work", "[heap_array]") {
 
 }
 
+TEST_CASE("move construction and assignment transfer ownership", "[heap_array]") {
+	heap_array<int> a{1, 2, 3};
+	int * data = a.data();
+
+	heap_array<int> b = std::move(a);
+	REQUIRE(b.data() == data);
+	REQUIRE(b.size() == 3);
+	REQUIRE(a.data() == nullptr);
+	REQUIRE(a.size() == 0);
+
+	heap_array<int> c{4, 5};
+	c = std::move(b);
+	REQUIRE(c.data() == data);
+	REQUIRE(c.size() == 3);
+	REQUIRE(b.data() == nullptr);
+	REQUIRE(b.size() == 0);
+}
+
+TEST_CASE("elements are destroyed exactly once", "[heap_array]") {
+	struct counter {
+		int * destroyed = nullptr;
+		~counter() { if (destroyed) ++*destroyed; }
+	};
+
+	int destroyed = 0;
+	{
+		auto array = heap_array<counter>::allocate(4);
+		for (counter & elem : array) elem.destroyed = &destroyed;
+		heap_array<counter> moved = std::move(array);
+	}
+	REQUIRE(destroyed == 4);
+}
+
+TEST_CASE("over-aligned types are allocated with the right alignment", "[heap_array]") {
+	struct alignas(64) aligned {
+		char data[64];
+	};
+
+	auto array = heap_array<aligned>::uninitialized(3);
+	REQUIRE(reinterpret_cast<std::uintptr_t>(array.data()) % 64 == 0);
+}
+
+TEST_CASE("aligned heap arrays respect the requested alignment", "[heap_array]") {
+	static_assert(heap_array<float>::alignment == alignof(float));
+	static_assert(aligned_heap_array<float, 32>::alignment == 32);
+
+	auto avx2   = aligned_heap_array<float, 32>::allocate(7);
+	auto avx512 = aligned_heap_array<float, 64>::uninitialized(13);
+	auto page   = aligned_heap_array<std::uint8_t, 4096>::allocate(5);
+
+	REQUIRE(reinterpret_cast<std::uintptr_t>(avx2.data())   % 32 == 0);
+	REQUIRE(reinterpret_cast<std::uintptr_t>(avx512.data()) % 64 == 0);
+	REQUIRE(reinterpret_cast<std::uintptr_t>(page.data())   % 4096 == 0);
+
+	view<float> as_view = avx2;
+	REQUIRE(as_view.data() == avx2.data());
+	REQUIRE(as_view.size() == 7);
+
+	aligned_view<float, 32> as_aligned = avx2;
+	REQUIRE(as_aligned.data() == avx2.data());
+	REQUIRE(as_aligned.size() == 7);
+
+	aligned_view<float const, 16> as_less_aligned = as_aligned;
+	REQUIRE(as_less_aligned.data() == avx2.data());
+
+	aligned_view<float const, 64> from_const = std::as_const(avx512);
+	REQUIRE(from_const.size() == 13);
+}
+
+TEST_CASE("stateless allocators take no space", "[heap_array]") {
+	static_assert(sizeof(heap_array<int>) == sizeof(int *) + sizeof(std::size_t));
+	static_assert(sizeof(aligned_heap_array<int, 64>) == sizeof(int *) + sizeof(std::size_t));
+}
+
+#ifdef ESTD_HAVE_MEMORY_RESOURCE
+TEST_CASE("pmr heap arrays allocate from the memory resource", "[heap_array]") {
+	std::pmr::monotonic_buffer_resource arena;
+
+	auto a = pmr::heap_array<int>::allocate(16, &arena);
+	REQUIRE(a.get_allocator().resource() == &arena);
+	REQUIRE(a.size() == 16);
+	REQUIRE(a[15] == 0);
+
+	SECTION("move construction keeps the memory resource and the data") {
+		int * data = a.data();
+		pmr::heap_array<int> b = std::move(a);
+		REQUIRE(b.get_allocator().resource() == &arena);
+		REQUIRE(b.data() == data);
+	}
+
+	SECTION("move assignment with the same memory resource takes over the data") {
+		int * data = a.data();
+		pmr::heap_array<int> b{&arena};
+		b = std::move(a);
+		REQUIRE(b.data() == data);
+		REQUIRE(a.data() == nullptr);
+	}
+
+	SECTION("move assignment with a different memory resource moves the elements") {
+		std::pmr::monotonic_buffer_resource other_arena;
+		a[3] = 3;
+		int * data = a.data();
+		pmr::heap_array<int> b{&other_arena};
+		b = std::move(a);
+		REQUIRE(b.get_allocator().resource() == &other_arena);
+		REQUIRE(b.data() != data);
+		REQUIRE(b.size() == 16);
+		REQUIRE(b[3] == 3);
+		REQUIRE(a.data() == nullptr);
+	}
+
+	SECTION("conversion to view works") {
+		view<int> as_view = a;
+		REQUIRE(as_view.data() == a.data());
+		REQUIRE(as_view.size() == a.size());
+	}
+}
+#endif
+
+TEST_CASE("resizing keeps the existing elements", "[heap_array]") {
+	SECTION("for trivially copyable types with an allocator that can reallocate") {
+		auto array = malloc_heap_array<int>{1, 2, 3};
+		array.resize(5);
+		REQUIRE(array.size() == 5);
+		REQUIRE(array[0] == 1);
+		REQUIRE(array[2] == 3);
+		REQUIRE(array[3] == 0);
+		REQUIRE(array[4] == 0);
+
+		array.shrink_to(2);
+		REQUIRE(array.size() == 2);
+		REQUIRE(array[0] == 1);
+		REQUIRE(array[1] == 2);
+	}
+
+	SECTION("for trivially copyable types with a regular allocator") {
+		auto array = heap_array<int>{1, 2, 3};
+		array.resize_uninitialized(1000);
+		REQUIRE(array.size() == 1000);
+		REQUIRE(array[0] == 1);
+		REQUIRE(array[2] == 3);
+	}
+
+	SECTION("for non-trivial types") {
+		auto array = heap_array<std::string>{"aap", "noot"};
+		array.resize(3);
+		REQUIRE(array.size() == 3);
+		REQUIRE(array[0] == "aap");
+		REQUIRE(array[1] == "noot");
+		REQUIRE(array[2] == "");
+
+		array.shrink_to(1);
+		REQUIRE(array.size() == 1);
+		REQUIRE(array[0] == "aap");
+	}
+
+	SECTION("for move-only types") {
+		auto array = heap_array<std::unique_ptr<int>>::allocate(1);
+		array[0] = std::make_unique<int>(10);
+		array.resize(2);
+		REQUIRE(*array[0] == 10);
+		REQUIRE(array[1] == nullptr);
+	}
+
+	SECTION("from and to an empty array") {
+		auto array = malloc_heap_array<int>{};
+		array.resize(4);
+		REQUIRE(array.size() == 4);
+		REQUIRE(array[3] == 0);
+		array.resize(0);
+		REQUIRE(array.empty());
+		REQUIRE(array.data() == nullptr);
+	}
+
+	SECTION("shrink_to() refuses to grow") {
+		auto array = heap_array<int>{1, 2, 3};
+		REQUIRE_THROWS_AS(array.shrink_to(4), std::length_error);
+		REQUIRE(array.size() == 3);
+	}
+}
+
 TEST_CASE("byte size works", "[heap_array]") {
 	REQUIRE(heap_array<std::uint32_t>::allocate(5).byte_size() == 20);
 }
@@ -156,4 +355,26 @@ TEST_CASE("equality comparison works", "[view]") {
 	REQUIRE((a != d) == true);
 }
 
+TEST_CASE("lexicographic comparison works", "[heap_array]") {
+	heap_array<int> a = {1, 2, 3};
+	heap_array<int> b = {1, 2, 4};
+	heap_array<int> c = {1, 2};
+
+	REQUIRE(a.compare(a) == 0);
+	REQUIRE(a < b);
+	REQUIRE(c < a);
+	REQUIRE(b > c);
+	REQUIRE(a <= a);
+	REQUIRE(a >= c);
+
+	std::vector<heap_array<int>> arrays;
+	arrays.push_back(std::move(b));
+	arrays.push_back(std::move(a));
+	arrays.push_back(std::move(c));
+	std::sort(arrays.begin(), arrays.end());
+	REQUIRE(arrays[0].size() == 2);
+	REQUIRE(arrays[1][2] == 3);
+	REQUIRE(arrays[2][2] == 4);
+}
+
 }
@@ -0,0 +1,87 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "heap_array/mmap_allocator.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <cstdint>
+
+namespace estd {
+
+TEST_CASE("mmap_allocator serves large and small allocations", "[heap_array]") {
+	auto policy = GENERATE(huge_page_policy::none, huge_page_policy::transparent, huge_page_policy::hugetlb);
+	mmap_allocator<int> allocator{4096, policy};
+
+	SECTION("large allocations are page aligned and zero-initialized") {
+		auto array = mmap_heap_array<int>::allocate(10000, allocator);
+		REQUIRE(array.size() == 10000);
+		REQUIRE(reinterpret_cast<std::uintptr_t>(array.data()) % 4096 == 0);
+		REQUIRE(array[0] == 0);
+		REQUIRE(array[9999] == 0);
+		array[9999] = 10;
+		REQUIRE(array[9999] == 10);
+	}
+
+	SECTION("small allocations work") {
+		auto array = mmap_heap_array<int>{{1, 2, 3}, allocator};
+		REQUIRE(array.size() == 3);
+		REQUIRE(array[2] == 3);
+	}
+
+	SECTION("resizing across the threshold keeps the data") {
+		auto array = mmap_heap_array<int>{{1, 2, 3}, allocator};
+		array.resize(5000);
+		REQUIRE(array[0] == 1);
+		REQUIRE(array[2] == 3);
+		REQUIRE(array[4999] == 0);
+
+		array[4999] = 4999;
+		array.resize(100000);
+		REQUIRE(array[0] == 1);
+		REQUIRE(array[4999] == 4999);
+		REQUIRE(array[99999] == 0);
+
+		array.shrink_to(2);
+		REQUIRE(array.size() == 2);
+		REQUIRE(array[1] == 2);
+	}
+}
+
+TEST_CASE("mmap_allocator compares equal only with the same settings", "[heap_array]") {
+	REQUIRE(mmap_allocator<int>{} == mmap_allocator<int>{});
+	REQUIRE(mmap_allocator<int>{1024} == mmap_allocator<char>{1024});
+	REQUIRE(mmap_allocator<int>{1024} != mmap_allocator<int>{2048});
+	REQUIRE(mmap_allocator<int>{1024, huge_page_policy::none} != mmap_allocator<int>{1024, huge_page_policy::hugetlb});
+}
+
+}
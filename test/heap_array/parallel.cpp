@@ -0,0 +1,108 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "heap_array/parallel.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace estd {
+
+TEST_CASE("parallel chunks cover the whole view", "[heap_array]") {
+	auto size   = GENERATE(std::size_t(0), std::size_t(10), std::size_t(1000), std::size_t(100000));
+	auto chunks = GENERATE(std::size_t(1), std::size_t(3), std::size_t(8));
+
+	auto array = heap_array<double>::uninitialized(size);
+	view<double> data = array;
+
+	double * expected_begin = data.begin();
+	for (std::size_t i = 0; i < chunks; ++i) {
+		view<double> chunk = parallel_chunk(data, chunks, i);
+		REQUIRE(chunk.begin() == expected_begin);
+		REQUIRE(chunk.end() >= chunk.begin());
+		if (chunk.begin() != data.begin() && chunk.size() > 0) {
+			std::uintptr_t address = reinterpret_cast<std::uintptr_t>(chunk.data());
+			CHECK(address % first_touch_granularity < sizeof(double));
+		}
+		expected_begin = chunk.end();
+	}
+	REQUIRE(expected_begin == data.end());
+}
+
+TEST_CASE("parallel allocation initializes all elements", "[heap_array]") {
+	SECTION("allocate_parallel() value-initializes") {
+		auto array = allocate_parallel<int>(100000, 4);
+		REQUIRE(array.size() == 100000);
+		REQUIRE(std::all_of(array.begin(), array.end(), [] (int x) { return x == 0; }));
+	}
+
+	SECTION("fill_parallel() fills with the value") {
+		auto array = fill_parallel<int>(100000, 7, 4);
+		REQUIRE(array.size() == 100000);
+		REQUIRE(std::all_of(array.begin(), array.end(), [] (int x) { return x == 7; }));
+	}
+
+	SECTION("custom executors are called for each chunk") {
+		std::vector<std::size_t> seen;
+		auto executor = [&seen] (std::size_t chunks, auto && task) {
+			for (std::size_t i = chunks; i-- > 0;) {
+				seen.push_back(i);
+				task(i);
+			}
+		};
+		auto array = fill_parallel<int>(100000, 3, 5, executor);
+		REQUIRE(seen == std::vector<std::size_t>{4, 3, 2, 1, 0});
+		REQUIRE(std::all_of(array.begin(), array.end(), [] (int x) { return x == 3; }));
+	}
+}
+
+TEST_CASE("parallel allocation rejects zero chunks", "[heap_array]") {
+	REQUIRE_THROWS_AS(allocate_parallel<int>(100, 0), std::invalid_argument);
+	REQUIRE_THROWS_AS(fill_parallel<int>(100, 7, 0), std::invalid_argument);
+}
+
+TEST_CASE("thread_per_chunk joins all threads when a task throws", "[heap_array]") {
+	std::atomic<std::size_t> finished{0};
+	auto task = [&finished] (std::size_t index) {
+		if (index == 0) throw std::runtime_error("task failed");
+		++finished;
+	};
+	REQUIRE_THROWS_AS(thread_per_chunk{}(4, task), std::runtime_error);
+	REQUIRE(finished == 3);
+}
+
+}
@@ -0,0 +1,132 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "heap_array/pool.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace estd {
+
+TEST_CASE("pooled heap arrays reuse storage", "[heap_array_pool]") {
+	byte_heap_array_pool pool;
+
+	std::uint8_t * data;
+	{
+		auto array = pool.allocate(1000);
+		REQUIRE(array.size() == 1000);
+		REQUIRE(array[999] == 0);
+		data = array.data();
+	}
+	REQUIRE(pool.stats().hits == 0);
+	REQUIRE(pool.stats().misses == 1);
+	REQUIRE(pool.stats().retained_bytes >= 1000);
+
+	SECTION("for the same size") {
+		auto array = pool.uninitialized(1000);
+		REQUIRE(array.data() == data);
+		REQUIRE(pool.stats().hits == 1);
+		REQUIRE(pool.stats().retained_bytes == 0);
+	}
+
+	SECTION("for a slightly smaller size in the same size class") {
+		auto array = pool.uninitialized(990);
+		REQUIRE(array.data() == data);
+		REQUIRE(pool.stats().hits == 1);
+	}
+
+	SECTION("but not for a much larger size") {
+		auto array = pool.uninitialized(2000);
+		REQUIRE(array.data() != data);
+		REQUIRE(pool.stats().hits == 0);
+		REQUIRE(pool.stats().misses == 2);
+	}
+
+	SECTION("until the pool is trimmed") {
+		pool.trim();
+		REQUIRE(pool.stats().retained_bytes == 0);
+		auto array = pool.uninitialized(1000);
+		REQUIRE(pool.stats().hits == 0);
+	}
+}
+
+TEST_CASE("heap array pools respect the retained bytes limit", "[heap_array_pool]") {
+	heap_array_pool<int> pool{100 * sizeof(int)};
+	{
+		auto a = pool.allocate(80);
+		auto b = pool.allocate(80);
+	}
+	REQUIRE(pool.stats().retained_bytes == 80 * sizeof(int));
+}
+
+TEST_CASE("heap array pools reject sizes that overflow when rounded to a size class", "[heap_array_pool]") {
+	heap_array_pool<std::uint8_t> byte_pool;
+	REQUIRE_THROWS_AS(byte_pool.allocate(std::size_t(-1)), std::bad_array_new_length);
+	REQUIRE_THROWS_AS(byte_pool.allocate(std::size_t(-1) - 1000), std::bad_array_new_length);
+
+	heap_array_pool<std::uint32_t> int_pool;
+	REQUIRE_THROWS_AS(int_pool.allocate(std::size_t(-1) / 4 + 1), std::bad_array_new_length);
+	REQUIRE(int_pool.stats().misses == 0);
+}
+
+TEST_CASE("heap array pools can be used from multiple threads", "[heap_array_pool]") {
+	heap_array_pool<int> pool;
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 4; ++i) {
+		threads.emplace_back([&pool] () {
+			for (int i = 0; i < 1000; ++i) {
+				auto array = pool.allocate(100 + i % 3);
+				array[0] = i;
+			}
+		});
+	}
+	for (std::thread & thread : threads) thread.join();
+
+	auto stats = pool.stats();
+	REQUIRE(stats.hits + stats.misses == 4000);
+	REQUIRE(stats.misses <= 4 * 3);
+}
+
+TEST_CASE("pooled heap arrays can be moved and viewed like regular heap arrays", "[heap_array_pool]") {
+	heap_array_pool<int> pool;
+	heap_array_pool<int>::array_type array = pool.allocate(3);
+	heap_array_pool<int>::array_type moved = std::move(array);
+	view<int> as_view = moved;
+	REQUIRE(as_view.size() == 3);
+	REQUIRE(moved.get_allocator().pool() == &pool);
+}
+
+}
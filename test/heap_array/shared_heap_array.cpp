@@ -0,0 +1,145 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "heap_array/shared_heap_array.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace estd {
+
+TEST_CASE("shared heap arrays can be created", "[shared_heap_array]") {
+	SECTION("default constructed arrays are empty") {
+		shared_heap_array<int> array;
+		REQUIRE(array.empty());
+		REQUIRE(array.data() == nullptr);
+		REQUIRE(array.use_count() == 0);
+	}
+
+	SECTION("from a list of values") {
+		shared_heap_array<int> array{1, 2, 3};
+		REQUIRE(array.size() == 3);
+		REQUIRE(array[0] == 1);
+		REQUIRE(array[2] == 3);
+		REQUIRE(array.use_count() == 1);
+	}
+
+	SECTION("with allocate()") {
+		auto array = shared_heap_array<int>::allocate(4);
+		REQUIRE(array.size() == 4);
+		REQUIRE(array[3] == 0);
+	}
+
+	SECTION("with an initialization function") {
+		auto array = shared_heap_array<int>::create(5, [] (view<int> data) {
+			for (std::size_t i = 0; i < data.size(); ++i) data[i] = i * 2;
+		});
+		REQUIRE(array.size() == 5);
+		REQUIRE(array[4] == 8);
+	}
+
+	SECTION("by copying a view") {
+		std::vector<std::string> values{"aap", "noot", "mies"};
+		auto array = shared_heap_array<std::string>::copy_from(values);
+		REQUIRE(array.size() == 3);
+		REQUIRE(array[1] == "noot");
+	}
+
+	SECTION("over-aligned types are aligned") {
+		struct alignas(64) aligned {
+			char data[64];
+		};
+		auto array = shared_heap_array<aligned>::allocate(2);
+		REQUIRE(reinterpret_cast<std::uintptr_t>(array.data()) % 64 == 0);
+	}
+}
+
+TEST_CASE("copies and slices of shared heap arrays share the elements", "[shared_heap_array]") {
+	shared_heap_array<int> array{1, 2, 3, 4, 5};
+
+	shared_heap_array<int> copy = array;
+	REQUIRE(copy.data() == array.data());
+	REQUIRE(array.use_count() == 2);
+
+	shared_heap_array<int> slice = array.slice(1, 3);
+	REQUIRE(slice.data() == array.data() + 1);
+	REQUIRE(slice.size() == 3);
+	REQUIRE(slice[0] == 2);
+	REQUIRE(slice[2] == 4);
+	REQUIRE(array.use_count() == 3);
+
+	shared_heap_array<int> nested = slice.slice(2, 1);
+	REQUIRE(nested.size() == 1);
+	REQUIRE(nested[0] == 4);
+	REQUIRE(array.use_count() == 4);
+
+	REQUIRE_THROWS_AS(array.slice(4, 2), std::range_error);
+	REQUIRE_THROWS_AS(array.slice(6, 0), std::range_error);
+
+	array = shared_heap_array<int>{};
+	copy  = shared_heap_array<int>{};
+	REQUIRE(slice.use_count() == 2);
+	REQUIRE(slice[1] == 3);
+
+	view<int const> as_view = slice;
+	REQUIRE(as_view.data() == slice.data());
+	REQUIRE(as_view.size() == 3);
+}
+
+TEST_CASE("elements of shared heap arrays are destroyed with the last reference", "[shared_heap_array]") {
+	struct counter {
+		int * destroyed = nullptr;
+		~counter() { if (destroyed) ++*destroyed; }
+	};
+
+	int destroyed = 0;
+	auto array = shared_heap_array<counter>::create(3, [&] (view<counter> data) {
+		for (counter & elem : data) elem.destroyed = &destroyed;
+	});
+
+	std::vector<shared_heap_array<counter>> copies;
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 4; ++i) copies.push_back(array.slice(1, 1));
+	for (auto & copy : copies) threads.emplace_back([copy = std::move(copy)] () mutable {
+		for (int i = 0; i < 1000; ++i) copy = shared_heap_array<counter>{copy};
+	});
+	for (auto & thread : threads) thread.join();
+
+	REQUIRE(destroyed == 0);
+	array = shared_heap_array<counter>{};
+	REQUIRE(destroyed == 3);
+}
+
+}
@@ -0,0 +1,105 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "heap_array/small_heap_array.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <memory>
+#include <string>
+
+namespace estd {
+
+TEST_CASE("small heap arrays store small arrays inline", "[small_heap_array]") {
+	small_heap_array<int, 4> array{1, 2, 3};
+	REQUIRE(array.is_inline());
+	REQUIRE(array.size() == 3);
+	REQUIRE(array.data() == reinterpret_cast<int *>(&array));
+	REQUIRE(array[0] == 1);
+	REQUIRE(array.at(2) == 3);
+	REQUIRE_THROWS_AS(array.at(3), std::range_error);
+
+	auto full = small_heap_array<int, 4>::allocate(4);
+	REQUIRE(full.is_inline());
+	REQUIRE(full[3] == 0);
+}
+
+TEST_CASE("small heap arrays store large arrays on the heap", "[small_heap_array]") {
+	small_heap_array<int, 4> array{1, 2, 3, 4, 5};
+	REQUIRE(!array.is_inline());
+	REQUIRE(array.size() == 5);
+	REQUIRE(array[4] == 5);
+
+	auto uninitialized = small_heap_array<std::string, 2>::uninitialized(10);
+	REQUIRE(!uninitialized.is_inline());
+	REQUIRE(uninitialized[9] == "");
+}
+
+TEST_CASE("small heap arrays can be moved", "[small_heap_array]") {
+	SECTION("with inline elements") {
+		small_heap_array<std::string, 4> array{"aap", "noot"};
+		small_heap_array<std::string, 4> moved = std::move(array);
+		REQUIRE(array.empty());
+		REQUIRE(moved.size() == 2);
+		REQUIRE(moved[1] == "noot");
+
+		array = std::move(moved);
+		REQUIRE(moved.empty());
+		REQUIRE(array[0] == "aap");
+	}
+
+	SECTION("with heap allocated elements") {
+		auto array = small_heap_array<std::unique_ptr<int>, 1>::allocate(3);
+		array[2] = std::make_unique<int>(2);
+		std::unique_ptr<int> * data = array.data();
+		small_heap_array<std::unique_ptr<int>, 1> moved = std::move(array);
+		REQUIRE(moved.data() == data);
+		REQUIRE(*moved[2] == 2);
+		REQUIRE(array.empty());
+	}
+}
+
+TEST_CASE("small heap arrays convert to views", "[small_heap_array]") {
+	small_heap_array<int, 4> array{1, 2, 3};
+	view<int> mut_view = array;
+	REQUIRE(mut_view.data() == array.data());
+	REQUIRE(mut_view.size() == 3);
+
+	small_heap_array<int, 4> const & const_array = array;
+	view<int const> const_view = const_array;
+	REQUIRE(const_view.data() == array.data());
+
+	REQUIRE((array == small_heap_array<int, 4>{1, 2, 3}) == true);
+	REQUIRE((array != small_heap_array<int, 4>{1, 2, 3, 4, 5}) == true);
+}
+
+}
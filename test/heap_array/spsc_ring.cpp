@@ -0,0 +1,141 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "heap_array/spsc_ring.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace estd {
+
+TEST_CASE("spsc_ring capacity is rounded up to a power of two", "[heap_array]") {
+	REQUIRE(spsc_ring<int>(1).capacity() == 1);
+	REQUIRE(spsc_ring<int>(5).capacity() == 8);
+	REQUIRE(spsc_ring<int>(64).capacity() == 64);
+	REQUIRE_THROWS_AS(spsc_ring<int>(0), std::invalid_argument);
+	REQUIRE(alignof(spsc_ring<int>) >= cache_line_size);
+}
+
+TEST_CASE("spsc_ring pushes and pops single elements in order", "[heap_array]") {
+	spsc_ring<int> ring(4);
+	REQUIRE(ring.empty());
+	REQUIRE(!ring.try_pop());
+
+	for (int i = 0; i < 4; ++i) REQUIRE(ring.try_push(i));
+	REQUIRE(!ring.try_push(4));
+	REQUIRE(ring.size() == 4);
+
+	REQUIRE(ring.try_pop() == 0);
+	REQUIRE(ring.try_push(4));
+	for (int i = 1; i < 5; ++i) REQUIRE(ring.try_pop() == i);
+	REQUIRE(ring.empty());
+}
+
+TEST_CASE("spsc_ring exposes one or two regions", "[heap_array]") {
+	spsc_ring<int> ring(8);
+
+	ring_regions<int> slots = ring.prepare_push(6);
+	REQUIRE(slots.first.size() == 6);
+	REQUIRE(slots.second.size() == 0);
+	for (std::size_t i = 0; i < 6; ++i) slots.first[i] = int(i);
+	ring.commit_push(6);
+
+	ring_regions<int> elements = ring.prepare_pop(10);
+	REQUIRE(elements.size() == 6);
+	ring.commit_pop(5);
+	REQUIRE(ring.size() == 1);
+
+	// The write position is now at slot 6, so a write of 6 elements wraps around.
+	slots = ring.prepare_push(100);
+	REQUIRE(slots.first.size() == 2);
+	REQUIRE(slots.second.size() == 5);
+	REQUIRE(slots.second.data() == slots.first.data() - 6);
+	REQUIRE_THROWS_AS(ring.commit_push(8), std::logic_error);
+	ring.commit_push(0);
+
+	std::size_t regions = 0;
+	int next = 6;
+	std::size_t pushed = ring.push_n(6, [&] (view<int> region) {
+		++regions;
+		for (int & slot : region) slot = next++;
+	});
+	REQUIRE(pushed == 6);
+	REQUIRE(regions == 2);
+
+	std::vector<int> popped;
+	REQUIRE(ring.pop_n(100, [&] (view<int> region) { popped.insert(popped.end(), region.begin(), region.end()); }) == 7);
+	REQUIRE(popped == std::vector<int>{5, 6, 7, 8, 9, 10, 11});
+	REQUIRE_THROWS_AS(ring.commit_pop(1), std::logic_error);
+}
+
+TEST_CASE("spsc_ring can move heap arrays", "[heap_array]") {
+	spsc_ring<byte_heap_array> ring(2);
+	REQUIRE(ring.try_push(byte_heap_array{1, 2, 3}));
+	std::optional<byte_heap_array> popped = ring.try_pop();
+	REQUIRE(popped);
+	REQUIRE(popped->size() == 3);
+	REQUIRE((*popped)[2] == 3);
+}
+
+TEST_CASE("spsc_ring transfers elements between threads in order", "[heap_array]") {
+	constexpr std::uint64_t count = 1000000;
+	spsc_ring<std::uint64_t> ring(1024);
+
+	std::thread producer([&ring] () {
+		std::uint64_t next = 0;
+		while (next < count) {
+			ring.push_n(std::min<std::uint64_t>(100, count - next), [&next] (view<std::uint64_t> region) {
+				for (std::uint64_t & slot : region) slot = next++;
+			});
+		}
+	});
+
+	std::uint64_t expected = 0;
+	bool in_order = true;
+	while (expected < count) {
+		ring.pop_n(64, [&] (view<std::uint64_t> region) {
+			for (std::uint64_t value : region) in_order = in_order && value == expected++;
+		});
+	}
+	producer.join();
+
+	REQUIRE(in_order);
+	REQUIRE(ring.empty());
+}
+
+}
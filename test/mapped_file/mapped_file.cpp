@@ -0,0 +1,128 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mapped_file/mapped_file.hpp"
+#include "result/catch_string_conversions.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace estd {
+
+namespace {
+	/// Temporary file that is removed when it goes out of scope.
+	struct temporary_file {
+		std::string path;
+
+		explicit temporary_file(std::string const & contents) {
+			char name[] = "/tmp/estd-mapped-file-XXXXXX";
+			int fd = ::mkstemp(name);
+			REQUIRE(fd >= 0);
+			::close(fd);
+			path = name;
+			std::ofstream{path, std::ios::binary} << contents;
+		}
+
+		~temporary_file() {
+			std::remove(path.c_str());
+		}
+
+		std::string read() const {
+			std::ifstream stream{path, std::ios::binary};
+			return {std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+		}
+	};
+}
+
+TEST_CASE("mapping a file gives access to its contents", "[mapped_file]") {
+	temporary_file file{"hello world!"};
+
+	result<mapped_file, error> mapped = mapped_file::open(file.path);
+	REQUIRE(mapped);
+	REQUIRE(mapped->size() == 12);
+	REQUIRE(mapped->writable() == false);
+	REQUIRE(std::string_view{reinterpret_cast<char const *>(mapped->data()), mapped->size()} == "hello world!");
+	REQUIRE(mapped->bytes().size() == 12);
+	REQUIRE(mapped->bytes()[6] == 'w');
+	REQUIRE_THROWS_AS(mapped->mut_bytes(), std::logic_error);
+
+	REQUIRE(mapped->advise(map_advice::sequential));
+	REQUIRE(mapped->advise(map_advice::will_need, 3, 4));
+	REQUIRE(mapped->advise(map_advice::dont_need));
+	REQUIRE(mapped->bytes()[0] == 'h');
+}
+
+TEST_CASE("writes to a read-write mapping end up in the file", "[mapped_file]") {
+	temporary_file file{"hello world!"};
+
+	{
+		result<mapped_file, error> mapped = mapped_file::open(file.path, map_mode::read_write);
+		REQUIRE(mapped);
+		REQUIRE(mapped->writable());
+		mapped->mut_bytes()[0] = 'j';
+		REQUIRE(mapped->sync());
+	}
+
+	REQUIRE(file.read() == "jello world!");
+}
+
+TEST_CASE("mapped files can be viewed as other types", "[mapped_file]") {
+	temporary_file file{"12345678"};
+	mapped_file mapped = mapped_file::open(file.path).value();
+
+	REQUIRE(mapped.as_view<std::uint32_t>());
+	REQUIRE(mapped.as_view<std::uint32_t>()->size() == 2);
+	REQUIRE(mapped.as_view<std::uint64_t>()->size() == 1);
+	REQUIRE(mapped.as_view<char[3]>().error_or() == std::errc::invalid_argument);
+}
+
+TEST_CASE("empty files can be mapped", "[mapped_file]") {
+	temporary_file file{""};
+	result<mapped_file, error> mapped = mapped_file::open(file.path);
+	REQUIRE(mapped);
+	REQUIRE(mapped->empty());
+	REQUIRE(mapped->bytes().size() == 0);
+}
+
+TEST_CASE("mapping a non-existing file fails", "[mapped_file]") {
+	result<mapped_file, error> mapped = mapped_file::open("/non/existing/file");
+	REQUIRE(!mapped);
+	REQUIRE(mapped.error() == std::errc::no_such_file_or_directory);
+}
+
+}
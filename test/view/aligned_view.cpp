@@ -0,0 +1,87 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "view/aligned_view.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <cstdint>
+#include <type_traits>
+
+namespace estd {
+
+TEST_CASE("aligned views check the alignment on creation", "[view]") {
+	alignas(32) float data[16] = {};
+
+	result<aligned_view<float, 32>, error> aligned = aligned_view<float, 32>::create(view<float>{data, 16});
+	REQUIRE(aligned);
+	REQUIRE(aligned->data() == data);
+	REQUIRE(aligned->size() == 16);
+	REQUIRE(aligned->byte_size() == 64);
+
+	REQUIRE(aligned_view<float, 32>::create(view<float>{data + 1, 8}).error_or() == std::errc::invalid_argument);
+	REQUIRE(aligned_view<float, 16>::create(view<float>{data + 4, 8}));
+
+	SECTION("empty views are aligned") {
+		REQUIRE(aligned_view<float, 64>::create(view<float>{static_cast<float *>(nullptr), std::size_t(0)}));
+		REQUIRE(aligned_view<float, 64>{}.size() == 0);
+	}
+}
+
+TEST_CASE("aligned views convert to views and to weaker alignments", "[view]") {
+	static_assert(aligned_view<float, 32>::alignment == 32);
+	static_assert(std::is_convertible_v<aligned_view<float, 32>, aligned_view<float, 16>>);
+	static_assert(std::is_convertible_v<aligned_view<float, 32>, aligned_view<float const, 32>>);
+	static_assert(!std::is_convertible_v<aligned_view<float, 16>, aligned_view<float, 32>>);
+	static_assert(!std::is_convertible_v<aligned_view<float const, 32>, aligned_view<float, 32>>);
+	static_assert(!std::is_convertible_v<view<float>, aligned_view<float, 32>>);
+
+	alignas(32) float data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+	aligned_view<float, 32> aligned = aligned_view<float, 32>::assume_aligned(view<float>{data, 8});
+
+	aligned[2] = 10;
+	REQUIRE(data[2] == 10);
+
+	view<float> plain = aligned;
+	REQUIRE(plain.data() == data);
+	REQUIRE(plain.size() == 8);
+
+	view<float const> plain_const = aligned;
+	REQUIRE(plain_const.data() == data);
+
+	aligned_view<float const, 16> weaker = aligned;
+	REQUIRE(weaker.data() == data);
+	REQUIRE(weaker.end() == data + 8);
+}
+
+}
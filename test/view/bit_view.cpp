@@ -0,0 +1,162 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "view/bit_view.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace estd {
+
+TEST_CASE("bit views access individual bits", "[view]") {
+	std::vector<std::uint64_t> words{0x5, 0x8000000000000001};
+	mut_bit_view bits{words.data(), 100};
+
+	REQUIRE(bits.size() == 100);
+	REQUIRE(bits.word_count() == 2);
+	REQUIRE(bits[0] == true);
+	REQUIRE(bits[1] == false);
+	REQUIRE(bits[2] == true);
+	REQUIRE(bits[64] == true);
+	REQUIRE(bits.test(99) == false);
+	REQUIRE_THROWS_AS(bits.test(100), std::out_of_range);
+
+	bits[1] = true;
+	REQUIRE(words[0] == 0x7);
+	bits.reset(0);
+	bits.flip(2);
+	REQUIRE(words[0] == 0x2);
+	bits[3] = bits[1];
+	REQUIRE(words[0] == 0xa);
+
+	bit_view read_only = bits;
+	REQUIRE(read_only[3] == true);
+	REQUIRE(read_only.words().size() == 2);
+	REQUIRE(read_only.words()[1] == 0x8000000000000001);
+}
+
+TEST_CASE("bit views ignore bits past the end", "[view]") {
+	std::vector<std::uint64_t> words{~std::uint64_t(0), ~std::uint64_t(0)};
+	mut_bit_view bits{words.data(), 70};
+
+	REQUIRE(bits.count() == 70);
+	REQUIRE(bits.find_next(70) == npos);
+
+	bits.fill(false);
+	REQUIRE(bits.count() == 0);
+	REQUIRE(bits.find_first() == npos);
+	REQUIRE(words[0] == 0);
+	REQUIRE(words[1] == ~std::uint64_t(0) << 6);
+
+	std::vector<std::uint64_t> other{0, 0};
+	REQUIRE(bits == bit_view{other.data(), 70});
+	REQUIRE(bits != bit_view{other.data(), 69});
+}
+
+TEST_CASE("bit views can fill ranges", "[view]") {
+	std::vector<std::uint64_t> words(4);
+	mut_bit_view bits{words.data(), 256};
+
+	bits.fill(3, 7, true);
+	REQUIRE(words[0] == 0x78);
+	bits.fill(60, 200, true);
+	REQUIRE(bits.count() == 4 + 140);
+	REQUIRE(bits.find_next(7) == 60);
+	REQUIRE(words[1] == ~std::uint64_t(0));
+	REQUIRE(words[3] == 0xff);
+	bits.fill(0, 256, false);
+	REQUIRE(bits.count() == 0);
+}
+
+TEST_CASE("bit views find set bits", "[view]") {
+	std::vector<std::uint64_t> words(20);
+	mut_bit_view bits{words.data(), 1280};
+
+	REQUIRE(bits.find_first() == npos);
+	std::vector<std::size_t> expected{3, 64, 65, 700, 1279};
+	for (std::size_t index : expected) bits.set(index);
+
+	std::vector<std::size_t> found;
+	for (std::size_t i = bits.find_first(); i != npos; i = bits.find_next(i + 1)) found.push_back(i);
+	REQUIRE(found == expected);
+	REQUIRE(bits.count() == expected.size());
+
+	std::size_t iterated = 0;
+	for (bool bit : bit_view{bits}) iterated += bit;
+	REQUIRE(iterated == expected.size());
+}
+
+TEST_CASE("bit views combine masks", "[view]") {
+	// Use enough words to run the vector kernels, and a size that is not a multiple of the word size.
+	std::size_t size = 64 * 37 + 5;
+	std::vector<std::uint64_t> a_words(38);
+	std::vector<std::uint64_t> b_words(38);
+	for (std::size_t i = 0; i < 38; ++i) {
+		a_words[i] = 0xff00ff00ff00ff00 ^ i;
+		b_words[i] = 0x0ff00ff00ff00ff0 + i;
+	}
+	a_words.back() |= ~std::uint64_t(0) << 5;
+
+	auto check = [&] (auto op, auto combine) {
+		std::vector<std::uint64_t> result = a_words;
+		combine(mut_bit_view{result.data(), size}, bit_view{b_words.data(), size});
+		for (std::size_t i = 0; i + 1 < result.size(); ++i) REQUIRE(result[i] == op(a_words[i], b_words[i]));
+		std::uint64_t mask = (std::uint64_t(1) << 5) - 1;
+		REQUIRE((result.back() & mask) == (op(a_words.back(), b_words.back()) & mask));
+		REQUIRE((result.back() & ~mask) == (a_words.back() & ~mask));
+	};
+
+	check([] (std::uint64_t a, std::uint64_t b) { return a & b; },  [] (mut_bit_view a, bit_view b) { a &= b; });
+	check([] (std::uint64_t a, std::uint64_t b) { return a | b; },  [] (mut_bit_view a, bit_view b) { a |= b; });
+	check([] (std::uint64_t a, std::uint64_t b) { return a ^ b; },  [] (mut_bit_view a, bit_view b) { a ^= b; });
+	check([] (std::uint64_t a, std::uint64_t b) { return a & ~b; }, [] (mut_bit_view a, bit_view b) { a.and_not(b); });
+
+	mut_bit_view a{a_words.data(), size};
+	bit_view shorter{b_words.data(), size - 1};
+	REQUIRE_THROWS_AS(a &= shorter, std::length_error);
+}
+
+TEST_CASE("bit views count large masks", "[view]") {
+	std::vector<std::uint64_t> words(1000);
+	std::size_t expected = 0;
+	for (std::size_t i = 0; i < words.size(); ++i) {
+		words[i] = i * 0x9e3779b97f4a7c15;
+		expected += __builtin_popcountll(words[i]);
+	}
+	REQUIRE(bit_view{words.data(), words.size() * 64}.count() == expected);
+}
+
+}
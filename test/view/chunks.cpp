@@ -0,0 +1,133 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "view/chunks.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace estd {
+
+TEST_CASE("chunks() splits a view in chunks of nearly equal size", "[view]") {
+	std::vector<int> vec(10);
+	view<int> data{vec};
+
+	view_chunks<int> range = chunks(data, 3);
+	REQUIRE(range.size() == 3);
+	REQUIRE(range[0].begin() == data.begin());
+	REQUIRE(range[0].size() == 4);
+	REQUIRE(range[1].size() == 3);
+	REQUIRE(range[2].size() == 3);
+	REQUIRE(range[2].end() == data.end());
+
+	SECTION("with more chunks than elements") {
+		view_chunks<int> many = chunks(data, 15);
+		REQUIRE(many.size() == 15);
+		REQUIRE(many[9].size() == 1);
+		REQUIRE(many[10].size() == 0);
+		REQUIRE(many[14].end() == data.end());
+	}
+
+	SECTION("with zero chunks") {
+		REQUIRE(chunks(data, 0).empty());
+		REQUIRE(chunks(data, 0).begin() == chunks(data, 0).end());
+	}
+}
+
+TEST_CASE("chunks_of() splits a view in chunks of a fixed size", "[view]") {
+	std::vector<int> vec(10);
+	view<int> data{vec};
+
+	view_chunks<int> range = chunks_of(data, 4);
+	REQUIRE(range.size() == 3);
+	REQUIRE(range[0].size() == 4);
+	REQUIRE(range[1].size() == 4);
+	REQUIRE(range[2].size() == 2);
+	REQUIRE(range[2].end() == data.end());
+
+	REQUIRE(chunks_of(data, 5).size() == 2);
+
+	view_chunks<int> whole = chunks_of(view<int>{vec.data(), 2}, std::numeric_limits<std::size_t>::max());
+	REQUIRE(whole.size() == 1);
+	REQUIRE(whole[0].size() == 2);
+	REQUIRE(chunks_of(view<int>{nullptr, std::size_t(0)}, 5).empty());
+	REQUIRE_THROWS_AS(chunks_of(data, 0), std::invalid_argument);
+	REQUIRE_THROWS_AS(chunks(data, 2, 0), std::invalid_argument);
+}
+
+TEST_CASE("chunk ranges are random access", "[view]") {
+	std::vector<int> vec(100);
+	view_chunks<int> range = chunks(view<int>{vec}, 7);
+
+	static_assert(std::is_same_v<std::iterator_traits<view_chunks<int>::iterator>::iterator_category, std::random_access_iterator_tag>);
+	REQUIRE(range.end() - range.begin() == 7);
+	REQUIRE(range.begin()[3] == range[3]);
+	REQUIRE(*(range.begin() + 6) == range[6]);
+	REQUIRE(range.at(6) == range[6]);
+	REQUIRE_THROWS_AS(range.at(7), std::out_of_range);
+
+	std::size_t total = 0;
+	for (view<int> chunk : range) total += chunk.size();
+	REQUIRE(total == vec.size());
+}
+
+TEST_CASE("aligned chunks cover the whole view with aligned boundaries", "[view]") {
+	auto size   = GENERATE(std::size_t(0), std::size_t(10), std::size_t(1000), std::size_t(100000));
+	auto count  = GENERATE(std::size_t(1), std::size_t(3), std::size_t(8));
+	auto offset = GENERATE(std::size_t(0), std::size_t(1), std::size_t(5));
+
+	std::vector<std::uint16_t> vec(size + offset);
+	view<std::uint16_t> data{vec.data() + offset, size};
+
+	for (view_chunks<std::uint16_t> range : {chunks(data, count, cache_line_size), chunks_of(data, count * 10, cache_line_size)}) {
+		std::uint16_t * expected_begin = data.begin();
+		for (view<std::uint16_t> chunk : range) {
+			REQUIRE(chunk.begin() == expected_begin);
+			REQUIRE(chunk.end() >= chunk.begin());
+			if (chunk.begin() != data.begin() && chunk.size() > 0) {
+				std::uintptr_t address = reinterpret_cast<std::uintptr_t>(chunk.data());
+				CHECK(address % cache_line_size == 0);
+			}
+			expected_begin = chunk.end();
+		}
+		REQUIRE(expected_begin == data.end());
+	}
+}
+
+}
@@ -0,0 +1,126 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "view/nd_view.hpp"
+#include "range/enumerate.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <numeric>
+#include <vector>
+
+namespace estd {
+
+TEST_CASE("nd_view indexes contiguous data in row-major order", "[nd_view]") {
+	std::vector<int> data(2 * 3 * 4);
+	std::iota(data.begin(), data.end(), 0);
+	nd_view<int, 3> image{data, {2, 3, 4}};
+
+	REQUIRE(image.size() == 24);
+	REQUIRE(image.extent(0) == 2);
+	REQUIRE(image.stride(0) == 12);
+	REQUIRE(image.stride(1) == 4);
+	REQUIRE(image.stride(2) == 1);
+	REQUIRE(image.is_contiguous());
+
+	REQUIRE(image(0, 0, 0) == 0);
+	REQUIRE(image(0, 0, 3) == 3);
+	REQUIRE(image(0, 2, 1) == 9);
+	REQUIRE(image(1, 2, 3) == 23);
+	REQUIRE(image.at({1, 0, 2}) == 14);
+	REQUIRE_THROWS_AS(image.at({2, 0, 0}), std::range_error);
+
+	REQUIRE(image[1][2][3] == 23);
+	REQUIRE(image.flat().data() == data.data());
+	REQUIRE(image.flat().size() == 24);
+
+	REQUIRE_THROWS_AS((nd_view<int, 2>{data, {5, 5}}), std::invalid_argument);
+}
+
+TEST_CASE("nd_view sub-views share the data", "[nd_view]") {
+	std::vector<int> data(5 * 6);
+	std::iota(data.begin(), data.end(), 0);
+	nd_view<int, 2> image{data, {5, 6}};
+
+	nd_view<int, 2> roi = image.subview({1, 2}, {3, 2});
+	REQUIRE(roi.extent(0) == 3);
+	REQUIRE(roi.extent(1) == 2);
+	REQUIRE(roi.is_contiguous() == false);
+	REQUIRE(roi(0, 0) == 8);
+	REQUIRE(roi(2, 1) == 21);
+	REQUIRE_THROWS_AS(roi.flat(), std::logic_error);
+	REQUIRE_THROWS_AS(image.subview({4, 0}, {2, 1}), std::range_error);
+
+	roi(0, 0) = -1;
+	REQUIRE(data[8] == -1);
+
+	SECTION("a single full-width row is contiguous") {
+		REQUIRE(image.subview({2, 0}, {1, 6}).is_contiguous());
+	}
+
+	SECTION("views convert to const views") {
+		nd_view<int const, 2> const_roi = roi;
+		REQUIRE(const_roi(2, 1) == 21);
+	}
+}
+
+TEST_CASE("nd_view rows are contiguous views", "[nd_view]") {
+	std::vector<int> data(4 * 3 * 2);
+	std::iota(data.begin(), data.end(), 0);
+	nd_view<int, 3> image{data, {4, 3, 2}};
+
+	SECTION("for the whole view") {
+		auto rows = image.rows();
+		REQUIRE(rows.size() == 12);
+		REQUIRE(rows.end() - rows.begin() == 12);
+		REQUIRE(rows[5].data() == data.data() + 10);
+		REQUIRE(rows[5].size() == 2);
+	}
+
+	SECTION("for a region of interest") {
+		nd_view<int, 3> roi = image.subview({1, 1, 0}, {2, 2, 2});
+		std::vector<int> firsts;
+		for (auto [i, row] : enumerate(roi.rows())) {
+			REQUIRE(row.size() == 2);
+			REQUIRE(row[0] == roi(i / 2, i % 2, 0));
+			firsts.push_back(row[0]);
+		}
+		REQUIRE(firsts == std::vector<int>{8, 10, 14, 16});
+	}
+
+	SECTION("but not for non-contiguous innermost dimensions") {
+		nd_view<int, 2> columns{data.data(), {2, 12}, {1, 2}};
+		REQUIRE_THROWS_AS(columns.rows(), std::logic_error);
+	}
+}
+
+}
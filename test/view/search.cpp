@@ -0,0 +1,138 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "view/search.hpp"
+
+#include "../bytes.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <algorithm>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace estd {
+
+namespace {
+	/// Random bytes from a small alphabet, so that every search has hits and near misses.
+	std::vector<std::uint8_t> random_bytes(std::size_t size, std::uint8_t alphabet) {
+		std::mt19937 generator{1234};
+		std::uniform_int_distribution<int> distribution{0, alphabet - 1};
+		std::vector<std::uint8_t> result(size);
+		for (std::uint8_t & byte : result) byte = std::uint8_t('a' + distribution(generator));
+		return result;
+	}
+
+	std::size_t reference_find(byte_view haystack, byte_view needle) {
+		auto found = std::search(haystack.begin(), haystack.end(), needle.begin(), needle.end());
+		return found == haystack.end() && needle.size() > 0 ? npos : std::size_t(found - haystack.begin());
+	}
+
+	std::size_t reference_find_any(byte_view haystack, byte_view set) {
+		auto found = std::find_first_of(haystack.begin(), haystack.end(), set.begin(), set.end());
+		return found == haystack.end() ? npos : std::size_t(found - haystack.begin());
+	}
+}
+
+TEST_CASE("find locates bytes and sequences", "[search]") {
+	byte_view haystack = bytes("the quick brown fox jumps over the lazy dog");
+
+	REQUIRE(find(haystack, 'q') == 4);
+	REQUIRE(find(haystack, 'g') == haystack.size() - 1);
+	REQUIRE(find(haystack, 'Q') == npos);
+	REQUIRE(find(byte_view{nullptr, nullptr}, 'a') == npos);
+
+	REQUIRE(find(haystack, bytes("the")) == 0);
+	REQUIRE(find(haystack, bytes("the lazy")) == 31);
+	REQUIRE(find(haystack, bytes("dog")) == haystack.size() - 3);
+	REQUIRE(find(haystack, bytes("cat")) == npos);
+	REQUIRE(find(haystack, bytes("")) == 0);
+	REQUIRE(find(bytes("do"), bytes("dog")) == npos);
+
+	REQUIRE(find_any(haystack, bytes("xyz")) == 18);
+	REQUIRE(find_any(haystack, bytes("XYZ")) == npos);
+	REQUIRE(find_any(haystack, bytes("")) == npos);
+
+	REQUIRE(count(haystack, 'o') == 4);
+	REQUIRE(count(haystack, ' ') == 8);
+	REQUIRE(count(haystack, '!') == 0);
+}
+
+TEST_CASE("search results match the standard algorithms", "[search]") {
+	std::vector<std::uint8_t> data = random_bytes(1500, 8);
+	std::vector<std::uint8_t> large_set;
+	for (int i = 0; i < 256; i += 3) large_set.push_back(std::uint8_t(i));
+	large_set.push_back('h');
+
+	// The public functions dispatch to AVX2 when available, so the SSE2 kernels are compared against them directly.
+	// Vary the start and size to cover unaligned loads, full blocks and tails of every kernel.
+	for (std::size_t offset : {0, 1, 7}) {
+		for (std::size_t size = 0; size + offset <= data.size(); size += (size < 140 ? 1 : 97)) {
+			byte_view haystack{data.data() + offset, size};
+			for (std::uint8_t needle : {'a', 'h', 'z'}) {
+				REQUIRE(find(haystack, needle) == reference_find(haystack, byte_view{&needle, 1}));
+				REQUIRE(count(haystack, needle) == std::size_t(std::count(haystack.begin(), haystack.end(), needle)));
+#if defined(__SSE2__)
+				REQUIRE(detail::search::find_sse2(haystack.data(), size, needle) == find(haystack, needle));
+				REQUIRE(detail::search::count_sse2(haystack.data(), size, needle) == count(haystack, needle));
+#endif
+			}
+			for (byte_view set : {bytes("gh"), bytes("zyxwvutsrqponmlkjih"), byte_view{large_set}}) {
+				REQUIRE(find_any(haystack, set) == reference_find_any(haystack, set));
+#if defined(__SSE2__)
+				if (set.size() <= detail::search::find_any_sse2_max_set) {
+					REQUIRE(detail::search::find_any_sse2(haystack.data(), size, set.data(), set.size()) == find_any(haystack, set));
+				}
+#endif
+			}
+			for (byte_view needle : {bytes("ab"), bytes("hgf"), bytes("abcabcab"), byte_view{data.data() + 1000, 40}}) {
+				REQUIRE(find(haystack, needle) == reference_find(haystack, needle));
+#if defined(__SSE2__)
+				if (needle.size() <= size) {
+					REQUIRE(detail::search::find_subsequence_sse2(haystack.data(), size, needle.data(), needle.size()) == find(haystack, needle));
+				}
+#endif
+			}
+		}
+	}
+}
+
+TEST_CASE("count handles more matches than fit in a byte lane", "[search]") {
+	std::vector<std::uint8_t> data(100000, 'x');
+	data[5] = 'y';
+	REQUIRE(count(data, 'x') == data.size() - 1);
+	REQUIRE(count(data, 'y') == 1);
+}
+
+}
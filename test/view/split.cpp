@@ -0,0 +1,115 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "view/split.hpp"
+#include "range/enumerate.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace estd {
+
+namespace {
+	template<typename Range>
+	std::vector<std::string> collect(Range && range) {
+		std::vector<std::string> result;
+		for (auto piece : range) result.emplace_back(piece.begin(), piece.end());
+		return result;
+	}
+}
+
+TEST_CASE("split a string on a single character", "[split]") {
+	using pieces = std::vector<std::string>;
+	REQUIRE(collect(split("a,bb,,ccc", ',')) == pieces{"a", "bb", "", "ccc"});
+	REQUIRE(collect(split("a,b,", ',')) == pieces{"a", "b", ""});
+	REQUIRE(collect(split(",", ',')) == pieces{"", ""});
+	REQUIRE(collect(split("", ',')) == pieces{""});
+	REQUIRE(collect(split("no delimiter", ',')) == pieces{"no delimiter"});
+}
+
+TEST_CASE("split a string on a sequence of characters", "[split]") {
+	using pieces = std::vector<std::string>;
+	REQUIRE(collect(split("a\r\nb\r\n\r\nc", "\r\n")) == pieces{"a", "b", "", "c"});
+	REQUIRE(collect(split("a::b:c", "::")) == pieces{"a", "b:c"});
+	REQUIRE(collect(split("ab", "abc")) == pieces{"ab"});
+	REQUIRE(collect(split("a,b", std::string_view{","})) == pieces{"a", "b"});
+	REQUIRE_THROWS_AS(split("abc", ""), std::invalid_argument);
+}
+
+TEST_CASE("split pieces point into the original data", "[split]") {
+	std::string text(1000, 'x');
+	for (std::size_t i = 0; i < text.size(); i += 37) text[i] = '\n';
+
+	std::size_t expected_offset = 0;
+	for (std::string_view line : split(text, '\n')) {
+		REQUIRE(line.data() == text.data() + expected_offset);
+		REQUIRE(line.find('\n') == std::string_view::npos);
+		expected_offset += line.size() + 1;
+	}
+	REQUIRE(expected_offset == text.size() + 1);
+}
+
+TEST_CASE("split views of bytes and other element types", "[split]") {
+	std::vector<std::uint8_t> bytes{1, 0, 2, 3, 0, 0, 4};
+	std::vector<std::vector<std::uint8_t>> pieces;
+	for (byte_view piece : split(byte_view{bytes}, 0)) pieces.emplace_back(piece.begin(), piece.end());
+	REQUIRE(pieces == std::vector<std::vector<std::uint8_t>>{{1}, {2, 3}, {}, {4}});
+
+	std::vector<int> numbers{1, -1, -2, 2, 3, -1, -2, 4};
+	std::vector<int> delimiter{-1, -2};
+	std::vector<std::size_t> sizes;
+	for (view<int> piece : split(view<int>{numbers}, view<int const>{delimiter})) {
+		sizes.push_back(piece.size());
+		if (piece.size() > 0) piece[0] *= 10;
+	}
+	REQUIRE(sizes == std::vector<std::size_t>{1, 2, 1});
+	REQUIRE(numbers == std::vector<int>{10, -1, -2, 20, 3, -1, -2, 40});
+}
+
+TEST_CASE("split works with enumerate", "[split]") {
+	std::vector<std::string_view> fields;
+	for (auto [index, field] : enumerate(split("zero;one;two", ';'))) {
+		REQUIRE(std::size_t(index) == fields.size());
+		fields.push_back(field);
+	}
+	REQUIRE(fields == std::vector<std::string_view>{"zero", "one", "two"});
+
+	static_assert(std::is_same_v<std::iterator_traits<split_iterator<std::string_view>>::iterator_category, std::forward_iterator_tag>);
+	auto range = split("a b c", ' ');
+	REQUIRE(std::distance(range.begin(), range.end()) == 3);
+}
+
+}
@@ -0,0 +1,122 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "view/strided_view.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace estd {
+
+TEST_CASE("strided views access every n-th element", "[strided_view]") {
+	std::vector<float> points{0, 1, 2, 10, 11, 12, 20, 21, 22, 30, 31, 32};
+
+	strided_view<float> x{points, 3};
+	strided_view<float> y{points, 3, 1};
+	strided_view<float const> z{view<float const>{points}, 3, 2};
+
+	REQUIRE(x.size() == 4);
+	REQUIRE(y.size() == 4);
+	REQUIRE(z.size() == 4);
+	REQUIRE(x.stride() == 3);
+	REQUIRE(x[1] == 10);
+	REQUIRE(y[2] == 21);
+	REQUIRE(z.at(3) == 32);
+	REQUIRE_THROWS_AS(z.at(4), std::range_error);
+
+	y[0] = -1;
+	REQUIRE(points[1] == -1);
+
+	SECTION("views can be created from a view with a stride that does not divide the size") {
+		REQUIRE((strided_view<float>{points, 5}.size()) == 3);
+		REQUIRE((strided_view<float>{points, 5, 2}.size()) == 2);
+		REQUIRE((strided_view<float>{points, 5, 12}.size()) == 0);
+		REQUIRE_THROWS_AS((strided_view<float>{points, 0}), std::invalid_argument);
+	}
+}
+
+TEST_CASE("strided view iterators are random access", "[strided_view]") {
+	std::vector<int> matrix(4 * 5);
+	std::iota(matrix.begin(), matrix.end(), 0);
+	strided_view<int> column{matrix.data() + 2, 4, 5};
+
+	static_assert(std::is_same_v<std::iterator_traits<strided_iterator<int>>::iterator_category, std::random_access_iterator_tag>);
+	REQUIRE(column.end() - column.begin() == 4);
+	REQUIRE(std::vector<int>(column.begin(), column.end()) == std::vector<int>{2, 7, 12, 17});
+	REQUIRE(column.begin()[3] == 17);
+	REQUIRE(*(column.end() - 1) == 17);
+	REQUIRE(column.begin() < column.end());
+
+	std::reverse(column.begin(), column.end());
+	REQUIRE(matrix[2] == 17);
+	REQUIRE(matrix[17] == 2);
+}
+
+TEST_CASE("strided views can be gathered into contiguous storage", "[strided_view]") {
+	std::vector<int> interleaved(3 * 100);
+	std::iota(interleaved.begin(), interleaved.end(), 0);
+
+	strided_view<int const> channel{view<int const>{interleaved}, 3, 1};
+	std::vector<int> gathered(100);
+	gather_to(channel, view<int>{gathered});
+	for (std::size_t i = 0; i < gathered.size(); ++i) REQUIRE(gathered[i] == int(3 * i + 1));
+
+	std::vector<int> too_small(10);
+	REQUIRE_THROWS_AS(gather_to(channel, view<int>{too_small}), std::length_error);
+
+	SECTION("mutable strided views and containers can be passed directly") {
+		strided_view<int> mutable_channel{view<int>{interleaved}, 3, 2};
+		std::vector<int> destination(100);
+		gather_to(mutable_channel, destination);
+		for (std::size_t i = 0; i < destination.size(); ++i) REQUIRE(destination[i] == int(3 * i + 2));
+	}
+
+	SECTION("contiguous views are copied directly") {
+		std::vector<int> copy(300);
+		gather_to(strided_view<int const>{view<int const>{interleaved}, 1}, view<int>{copy});
+		REQUIRE(copy == interleaved);
+	}
+}
+
+TEST_CASE("strided view end iterators do not point past the viewed data", "[strided_view]") {
+	std::vector<int> matrix(4 * 5);
+	strided_view<int> column{matrix.data() + 2, 4, 5};
+
+	REQUIRE(column.end().index() == 4);
+	REQUIRE(column.begin().index() == 0);
+	REQUIRE(&*(column.end() - 1) == matrix.data() + 17);
+}
+
+}
@@ -35,6 +35,10 @@
 #   include <catch2/catch.hpp>
 # endif
 
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace estd {
@@ -146,6 +150,82 @@ TEST_CASE("Equality comparison works", "[view]") {
 }
 
 
+TEST_CASE("Equality comparison of large byte views works", "[view]") {
+	std::vector<std::uint8_t> vec_a(1000, 7);
+	std::vector<std::uint8_t> vec_b(1000, 7);
+	view<std::uint8_t> view_a{vec_a};
+	view<std::uint8_t> view_b{vec_b};
+
+	for (std::size_t i : {std::size_t(0), std::size_t(15), std::size_t(31), std::size_t(32), std::size_t(999)}) {
+		REQUIRE(view_a == view_b);
+		vec_b[i] = 8;
+		REQUIRE(view_a != view_b);
+		vec_b[i] = 7;
+	}
+}
+
+TEST_CASE("Lexicographic comparison works", "[view]") {
+	SECTION("for signed integers") {
+		std::vector<int> vec_a{1, 2, 3};
+		std::vector<int> vec_b{1, 2, 4};
+		std::vector<int> vec_c{1, -2, 4};
+		std::vector<int> vec_d{1, 2};
+
+		view<int> view_a{vec_a};
+		view<int> view_b{vec_b};
+		view<int> view_c{vec_c};
+		view<int> view_d{vec_d};
+
+		REQUIRE(view_a.compare(view_a) == 0);
+		REQUIRE(view_a.compare(view_b) < 0);
+		REQUIRE(view_b.compare(view_a) > 0);
+		REQUIRE(view_c < view_a);
+		REQUIRE(view_d < view_a);
+		REQUIRE(view_a > view_d);
+		REQUIRE(view_a <= view_a);
+		REQUIRE(view_a >= view_a);
+		REQUIRE_FALSE(view_a < view_a);
+	}
+
+	SECTION("for unsigned bytes") {
+		std::vector<std::uint8_t> vec_a{0x01, 0x80};
+		std::vector<std::uint8_t> vec_b{0x01, 0x7f};
+		REQUIRE(view<std::uint8_t>{vec_b} < view<std::uint8_t>{vec_a});
+	}
+
+	SECTION("for large buffers with a late difference") {
+		std::vector<std::uint32_t> vec_a(1000, 5);
+		std::vector<std::uint32_t> vec_b(1000, 5);
+		vec_a[900] = 0x100;
+		vec_b[900] = 0x001;
+		REQUIRE(view<std::uint32_t>{vec_b} < view<std::uint32_t>{vec_a});
+		REQUIRE(view<std::uint32_t>{vec_a} > view<std::uint32_t>{vec_b});
+	}
+
+	SECTION("for class types") {
+		std::vector<std::string> vec_a{"aap", "noot"};
+		std::vector<std::string> vec_b{"aap", "mies"};
+		REQUIRE(view<std::string>{vec_b} < view<std::string>{vec_a});
+	}
+
+	SECTION("views can be used as keys in ordered containers") {
+		std::string a = "noot";
+		std::string b = "aap";
+		std::string c = "mies";
+
+		std::map<view<char const>, int> map;
+		map[view<char const>{a}] = 1;
+		map[view<char const>{b}] = 2;
+		map[view<char const>{c}] = 3;
+
+		std::string key = "aap";
+		REQUIRE(map.at(view<char const>{key}) == 2);
+		REQUIRE(map.begin()->second == 2);
+		REQUIRE(map.rbegin()->second == 1);
+	}
+}
+
+
 TEST_CASE("mutable views can mutate data", "[view]") {
 	std::vector<int> vec{1, 2, 3, 4, 5};
 	view<int> mut_view{vec.data(), vec.size()};
@@ -0,0 +1,106 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "view/view_cast.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace estd {
+
+TEST_CASE("view_cast() reinterprets byte views", "[view]") {
+	alignas(float) std::uint8_t bytes[12] = {};
+	float values[3] = {1.5f, -2.0f, 3.25f};
+	std::memcpy(bytes, values, sizeof(values));
+
+	byte_view data{bytes, sizeof(bytes)};
+	result<view<float const>, error> floats = view_cast<float const>(data);
+	REQUIRE(floats);
+	REQUIRE(floats->size() == 3);
+	REQUIRE(floats->data() == reinterpret_cast<float const *>(bytes));
+	REQUIRE((*floats)[2] == 3.25f);
+
+	SECTION("a size that is not a multiple of the element size fails") {
+		REQUIRE(view_cast<float const>(byte_view{bytes, 10}).error_or() == std::errc::invalid_argument);
+	}
+
+	SECTION("misaligned data fails") {
+		REQUIRE(view_cast<float const>(byte_view{bytes + 1, 8}).error_or() == std::errc::invalid_argument);
+	}
+
+	SECTION("empty views always succeed") {
+		REQUIRE(view_cast<double const>(byte_view{nullptr, std::size_t(0)}));
+		REQUIRE(view_cast<double const>(byte_view{nullptr, std::size_t(0)})->size() == 0);
+
+		result<view<float const>, error> misaligned = view_cast<float const>(byte_view{bytes + 1, std::size_t(0)});
+		REQUIRE(misaligned);
+		REQUIRE(misaligned->size() == 0);
+		REQUIRE(misaligned->data() == nullptr);
+	}
+}
+
+TEST_CASE("view_cast() works between typed views", "[view]") {
+	std::vector<std::uint32_t> words{0x01020304, 0x05060708};
+	view<std::uint32_t> data{words};
+
+	result<view<std::uint16_t>, error> halves = view_cast<std::uint16_t>(data);
+	REQUIRE(halves);
+	REQUIRE(halves->size() == 4);
+	(*halves)[0] = 0;
+	REQUIRE(words[0] != 0x01020304);
+
+	result<view<std::uint64_t const>, error> wide = view_cast<std::uint64_t const>(view<std::uint32_t>{words.data(), 1});
+	REQUIRE(wide.error_or() == std::errc::invalid_argument);
+}
+
+TEST_CASE("as_bytes() and as_writable_bytes() view the object representation", "[view]") {
+	std::vector<std::uint16_t> values{0x0102, 0x0304};
+	view<std::uint16_t> data{values};
+
+	byte_view bytes = as_bytes(data);
+	REQUIRE(bytes.data() == reinterpret_cast<std::uint8_t const *>(values.data()));
+	REQUIRE(bytes.size() == 4);
+
+	mut_byte_view writable = as_writable_bytes(data);
+	REQUIRE(writable.size() == 4);
+	writable[0] = 0xff;
+	writable[1] = 0xff;
+	REQUIRE(values[0] == 0xffff);
+
+	REQUIRE(as_bytes(view<std::uint16_t const>{values}).size() == 4);
+}
+
+}
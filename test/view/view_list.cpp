@@ -0,0 +1,115 @@
+/* Copyright 2026 Fizyr B.V. - https://fizyr.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "view/view_list.hpp"
+
+#include "../bytes.hpp"
+
+# if __has_include(<catch2/catch_test_macros.hpp>)
+#   include <catch2/catch_test_macros.hpp>
+# else
+#   include <catch2/catch.hpp>
+# endif
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <unistd.h>
+
+namespace estd {
+
+namespace {
+	std::string text(byte_view data) {
+		return {reinterpret_cast<char const *>(data.data()), data.size()};
+	}
+}
+
+TEST_CASE("view_list holds views inline", "[view_list]") {
+	view_list<4> list{bytes("header:"), bytes("payload"), bytes(";")};
+	REQUIRE(list.size() == 3);
+	REQUIRE(list.capacity() == 4);
+	REQUIRE(list.total_size() == 15);
+	REQUIRE(text(list[1]) == "payload");
+
+	std::vector<std::string> pieces;
+	for (byte_view view : list) pieces.push_back(text(view));
+	REQUIRE(pieces == std::vector<std::string>{"header:", "payload", ";"});
+	REQUIRE(list.end() - list.begin() == 3);
+
+	list.push_back(bytes("trailer"));
+	REQUIRE(list.total_size() == 22);
+	REQUIRE_THROWS_AS(list.push_back(bytes("x")), std::length_error);
+
+	list.clear();
+	REQUIRE(list.empty());
+	REQUIRE(list.total_size() == 0);
+}
+
+TEST_CASE("view_list can be copied into a contiguous buffer", "[view_list]") {
+	view_list<> list{bytes("abc"), bytes(""), bytes("de")};
+	std::uint8_t buffer[8];
+
+	REQUIRE(list.copy_to(mut_byte_view{buffer, sizeof(buffer)}) == 5);
+	REQUIRE(text(byte_view{buffer, 5}) == "abcde");
+	REQUIRE_THROWS_AS(list.copy_to(mut_byte_view{buffer, 4}), std::length_error);
+}
+
+TEST_CASE("view_list can drop bytes that have been written", "[view_list]") {
+	view_list<> list{bytes("abc"), bytes("def"), bytes("ghi")};
+
+	list.consume(4);
+	REQUIRE(list.size() == 2);
+	REQUIRE(list.total_size() == 5);
+	REQUIRE(text(list[0]) == "ef");
+	REQUIRE(text(list[1]) == "ghi");
+
+	list.consume(2);
+	REQUIRE(list.size() == 1);
+	REQUIRE(text(list[0]) == "ghi");
+
+	list.consume(100);
+	REQUIRE(list.empty());
+}
+
+TEST_CASE("view_list can be passed to writev", "[view_list]") {
+	int fds[2];
+	REQUIRE(::pipe(fds) == 0);
+
+	view_list<> list{bytes("hello"), bytes(", "), bytes("world")};
+	REQUIRE(::writev(fds[1], list.data(), int(list.size())) == ssize_t(list.total_size()));
+
+	char buffer[32];
+	ssize_t count = ::read(fds[0], buffer, sizeof(buffer));
+	REQUIRE(std::string_view{buffer, std::size_t(count)} == "hello, world");
+	::close(fds[0]);
+	::close(fds[1]);
+}
+
+}